@@ -0,0 +1,172 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "static_vector.hpp"
+
+template<typename T, std::size_t Capacity, std::size_t Slots = 3>
+class atomic_static_vector_publisher
+{
+	static_assert(Slots >= 2, "Publishing needs at least one slot besides the current one");
+	static_assert(Slots < (1u << 16), "Slot indices are packed into 16 bits");
+
+private:
+	static constexpr unsigned slot_shift = 48;
+	static constexpr std::uint64_t count_mask = (std::uint64_t{ 1 } << slot_shift) - 1;
+
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+	using vector_type = static_vector<T, Capacity>;
+
+	class read_guard
+	{
+	public:
+		read_guard(read_guard&& other) noexcept
+			: owner_{ std::exchange(other.owner_, nullptr) }, slot_{ other.slot_ }
+		{
+		}
+
+		read_guard& operator=(read_guard&& other) noexcept
+		{
+			if (this != std::addressof(other))
+			{
+				release();
+				owner_ = std::exchange(other.owner_, nullptr);
+				slot_ = other.slot_;
+			}
+			return *this;
+		}
+
+		~read_guard()
+		{
+			release();
+		}
+
+		const vector_type& operator*() const noexcept
+		{
+			return owner_->slots_[slot_];
+		}
+
+		const vector_type* operator->() const noexcept
+		{
+			return std::addressof(owner_->slots_[slot_]);
+		}
+
+		std::uint64_t version() const noexcept
+		{
+			return owner_->versions_[slot_];
+		}
+
+	private:
+		friend class atomic_static_vector_publisher;
+
+		read_guard(const atomic_static_vector_publisher* owner, std::size_t slot) noexcept
+			: owner_{ owner }, slot_{ slot }
+		{
+		}
+
+		void release() noexcept
+		{
+			if (owner_ != nullptr)
+			{
+				owner_->pending_[slot_].fetch_sub(1, std::memory_order_release);
+				owner_ = nullptr;
+			}
+		}
+
+		const atomic_static_vector_publisher* owner_;
+		std::size_t slot_;
+	};
+
+	atomic_static_vector_publisher() = default;
+
+	explicit atomic_static_vector_publisher(const vector_type& initial)
+	{
+		slots_[0] = initial;
+	}
+
+	atomic_static_vector_publisher(const atomic_static_vector_publisher&) = delete;
+	atomic_static_vector_publisher& operator=(const atomic_static_vector_publisher&) = delete;
+
+	read_guard read() const noexcept
+	{
+		const std::uint64_t word = current_.fetch_add(1, std::memory_order_acquire);
+		return read_guard{ this, static_cast<std::size_t>(word >> slot_shift) };
+	}
+
+	template<typename Function>
+		requires std::invocable<Function&, vector_type&>
+	std::uint64_t update(Function fn)
+	{
+		const std::lock_guard lock{ writer_mutex_ };
+
+		const std::size_t next = acquire_free_slot();
+		slots_[next] = slots_[current_slot_];
+		std::invoke(fn, slots_[next]);
+
+		return publish_slot(next);
+	}
+
+	std::uint64_t publish(const vector_type& values)
+	{
+		const std::lock_guard lock{ writer_mutex_ };
+
+		const std::size_t next = acquire_free_slot();
+		slots_[next] = values;
+
+		return publish_slot(next);
+	}
+
+	std::uint64_t version() const noexcept
+	{
+		return read().version();
+	}
+
+	static constexpr size_type slot_count() noexcept
+	{
+		return Slots;
+	}
+
+private:
+	std::size_t acquire_free_slot() const noexcept
+	{
+		while (true)
+		{
+			for (std::size_t slot = 0; slot != Slots; ++slot)
+			{
+				if (slot != current_slot_ && pending_[slot].load(std::memory_order_acquire) == 0)
+				{
+					return slot;
+				}
+			}
+			std::this_thread::yield();
+		}
+	}
+
+	std::uint64_t publish_slot(std::size_t slot) noexcept
+	{
+		versions_[slot] = versions_[current_slot_] + 1;
+
+		const std::uint64_t previous = current_.exchange(
+			static_cast<std::uint64_t>(slot) << slot_shift, std::memory_order_acq_rel);
+		pending_[previous >> slot_shift].fetch_add(
+			static_cast<std::int64_t>(previous & count_mask), std::memory_order_acq_rel);
+
+		current_slot_ = slot;
+		return versions_[slot];
+	}
+
+	std::array<vector_type, Slots> slots_{};
+	std::array<std::uint64_t, Slots> versions_{};
+	mutable std::array<std::atomic<std::int64_t>, Slots> pending_{};
+	mutable std::atomic<std::uint64_t> current_{ 0 };
+	std::size_t current_slot_ = 0;
+	std::mutex writer_mutex_;
+};
@@ -0,0 +1,495 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <mutex>
+#include <numeric>
+#include <random>
+#include <shared_mutex>
+#include <ranges>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include "seqlock_static_vector.hpp"
+#include "static_priority_queue.hpp"
+#include "static_vector_batching.hpp"
+#include "static_vector_parallel.hpp"
+#include "static_vector_search.hpp"
+#include "static_vector.hpp"
+
+namespace
+{
+	constexpr int repeats = 5;
+
+	volatile std::uint64_t sink = 0;
+
+	template<typename Body>
+	double best_ns(Body&& body)
+	{
+		auto best = std::chrono::steady_clock::duration::max();
+		for (int i = 0; i != repeats; ++i)
+		{
+			const auto start = std::chrono::steady_clock::now();
+			body();
+			best = std::min(best, std::chrono::steady_clock::now() - start);
+		}
+		return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(best).count());
+	}
+
+	void print_header(std::string_view parameter, std::string_view candidate, std::string_view baseline)
+	{
+		std::cout << std::left << std::setw(12) << parameter << std::right << std::setw(22) << candidate
+			<< std::setw(22) << baseline << std::setw(10) << "ratio" << '\n';
+	}
+
+	void print_row(std::size_t parameter, double candidate_ns, double baseline_ns)
+	{
+		std::cout << std::left << std::setw(12) << parameter << std::right << std::fixed << std::setprecision(1)
+			<< std::setw(22) << candidate_ns << std::setw(22) << baseline_ns
+			<< std::setw(10) << std::setprecision(2) << candidate_ns / baseline_ns << '\n';
+	}
+
+	std::string number_text(std::size_t count)
+	{
+		std::string text;
+		for (std::size_t i = 0; i != count; ++i)
+		{
+			text += std::to_string(i * 7 % 1000);
+			text += ' ';
+		}
+		return text;
+	}
+
+	void insert_range_benchmark()
+	{
+		constexpr std::size_t prefix = 4096;
+		print_header("inserted", "insert_range ns", "std::inserter ns");
+
+		for (std::size_t count : { 256uz, 1024uz, 4096uz })
+		{
+			const std::string text = number_text(count);
+			const auto doubled = [](int value) { return value * 2; };
+
+			const auto run = [&](auto insert)
+			{
+				return best_ns([&]
+				{
+					static_vector<int, 8192> vec(prefix, 1);
+					std::istringstream stream{ text };
+					insert(vec, std::views::istream<int>(stream) | std::views::transform(doubled));
+					sink = sink + vec[prefix / 2 + 1];
+				});
+			};
+
+			const double bulk = run([](auto& vec, auto&& range) { vec.insert_range(vec.begin() + prefix / 2, range); });
+			const double inserter = run([](auto& vec, auto&& range)
+			{
+				std::ranges::copy(range, std::inserter(vec, vec.begin() + prefix / 2));
+			});
+
+			print_row(count, bulk, inserter);
+		}
+	}
+
+	std::vector<int> random_values(std::size_t count, std::mt19937::result_type seed = 20240601)
+	{
+		std::mt19937 engine{ seed };
+		std::uniform_int_distribution<int> distribution{ 0, 1 << 30 };
+
+		std::vector<int> values(count);
+		std::ranges::generate(values, [&] { return distribution(engine); });
+		return values;
+	}
+
+	template<std::size_t Capacity, std::size_t Arity>
+	double push_pop_ns(const std::vector<int>& values)
+	{
+		return best_ns([&]
+		{
+			static_priority_queue<int, Capacity, std::less<int>, Arity> queue;
+			for (std::size_t i = 0; i != Capacity; ++i)
+			{
+				queue.push(values[i]);
+			}
+			while (not queue.empty())
+			{
+				sink = sink + static_cast<std::uint64_t>(queue.top());
+				queue.pop();
+			}
+		});
+	}
+
+	template<std::size_t Capacity, std::size_t Arity>
+	double push_bounded_ns(const std::vector<int>& values)
+	{
+		return best_ns([&]
+		{
+			static_priority_queue<int, Capacity, std::greater<int>, Arity> queue;
+			for (int value : values)
+			{
+				queue.push_bounded(value);
+			}
+			sink = sink + static_cast<std::uint64_t>(queue.top());
+		});
+	}
+
+	template<std::size_t ... Capacities>
+	void priority_queue_rows(const std::vector<int>& values)
+	{
+		std::cout << "push then pop all\n";
+		print_header("capacity", "4-ary ns", "binary ns");
+		(print_row(Capacities, push_pop_ns<Capacities, 4>(values), push_pop_ns<Capacities, 2>(values)), ...);
+
+		std::cout << "push_bounded over " << values.size() << " values\n";
+		print_header("capacity", "4-ary ns", "binary ns");
+		(print_row(Capacities, push_bounded_ns<Capacities, 4>(values), push_bounded_ns<Capacities, 2>(values)), ...);
+	}
+
+	void priority_queue_benchmark()
+	{
+		priority_queue_rows<64, 1024, 16384>(random_values(1 << 18));
+	}
+
+	std::vector<std::size_t> thread_counts()
+	{
+		const std::size_t hardware = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1,
+			parallel::jthread_policy::max_threads);
+
+		std::vector<std::size_t> counts;
+		for (std::size_t count = 1; count < hardware; count *= 2)
+		{
+			counts.push_back(count);
+		}
+		counts.push_back(hardware);
+		return counts;
+	}
+
+	void parallel_benchmark()
+	{
+		using vector_type = static_vector<float, 1 << 20>;
+		static vector_type source;
+		static vector_type vec;
+
+		source.clear();
+		for (const int value : random_values(source.capacity()))
+		{
+			source.push_back(static_cast<float>(value % 1000000));
+		}
+
+		const auto is_odd = [](float value) { return static_cast<int>(value) % 2 != 0; };
+		const auto scale = [](float value) { return value * 0.5f + 1.0f; };
+
+		const auto table = [&](std::string_view name, auto&& parallel_run, auto&& serial_run)
+		{
+			std::cout << name << " over " << source.size() << " floats\n";
+			print_header("threads", "jthread_policy ns", "serial ns");
+
+			const double serial = best_ns([&] { vec = source; serial_run(); });
+			for (const std::size_t threads : thread_counts())
+			{
+				const parallel::jthread_policy policy{ threads };
+				print_row(threads, best_ns([&] { vec = source; parallel_run(policy); }), serial);
+			}
+		};
+
+		table("transform",
+			[&](const auto& policy) { parallel::transform(policy, vec, scale); },
+			[&] { std::ranges::transform(vec, vec.begin(), scale); });
+		table("reduce",
+			[&](const auto& policy) { sink = sink + static_cast<std::uint64_t>(parallel::reduce(policy, vec, 0.0)); },
+			[&] { sink = sink + static_cast<std::uint64_t>(std::reduce(vec.begin(), vec.end(), 0.0)); });
+		table("sort",
+			[&](const auto& policy) { parallel::sort(policy, vec); },
+			[&] { std::ranges::sort(vec); });
+		table("erase_if",
+			[&](const auto& policy) { sink = sink + parallel::erase_if(policy, vec, is_odd); },
+			[&] { vec.erase(std::remove_if(vec.begin(), vec.end(), is_odd), vec.end()); });
+		table("find",
+			[&](const auto& policy) { sink = sink + static_cast<std::uint64_t>(parallel::find(policy, vec, -1.0f) - vec.begin()); },
+			[&] { sink = sink + static_cast<std::uint64_t>(std::ranges::find(vec, -1.0f) - vec.begin()); });
+	}
+
+	void sorted_insert_benchmark()
+	{
+		using vector_type = static_vector<int, 16384>;
+
+		vector_type base;
+		for (const int value : random_values(4096))
+		{
+			base.push_back(value);
+		}
+		std::ranges::sort(base);
+
+		const auto repeated_insert = [](vector_type& vec, const auto& batch)
+		{
+			for (const int value : batch)
+			{
+				vec.insert(std::ranges::upper_bound(vec, value), value);
+			}
+		};
+
+		const auto table = [&](std::string_view name, auto&& bulk, bool sorted_batch)
+		{
+			std::cout << name << " into " << base.size() << " sorted ints\n";
+			print_header("batch", std::string{ name } + " ns", "repeated insert ns");
+
+			for (const std::size_t count : { 64uz, 512uz, 4096uz })
+			{
+				std::vector<int> batch = random_values(count, 42);
+				if (sorted_batch)
+				{
+					std::ranges::sort(batch);
+				}
+
+				vector_type vec;
+				const double bulk_ns = best_ns([&] { vec = base; bulk(vec, batch); });
+				const double repeated_ns = best_ns([&] { vec = base; repeated_insert(vec, batch); });
+				sink = sink + static_cast<std::uint64_t>(vec[count]);
+
+				print_row(count, bulk_ns, repeated_ns);
+			}
+		};
+
+		table("insert_sorted_range", [](vector_type& vec, const auto& batch) { vec.insert_sorted_range(batch); }, false);
+		table("merge_from", [](vector_type& vec, const auto& batch) { vec.merge_from(batch); }, true);
+	}
+
+	template<typename T>
+	void lower_bound_rows(std::string_view type_name)
+	{
+		constexpr std::size_t lookups = 4096;
+		const std::vector<int> queries = random_values(lookups, 7);
+
+		std::cout << "lower_bound over static_vector<" << type_name << ", 256>, per lookup\n";
+		print_header("size", "linear ns", "branchless ns");
+
+		for (const std::size_t size : { 4uz, 8uz, 16uz, 32uz, 64uz, 128uz, 256uz })
+		{
+			static_vector<T, 256> vec;
+			for (std::size_t i = 0; i != size; ++i)
+			{
+				vec.push_back(static_cast<T>((i + 1) * ((1 << 30) / size)));
+			}
+
+			const auto lookup_ns = [&](auto search)
+			{
+				return best_ns([&]
+				{
+					std::size_t total = 0;
+					for (const int query : queries)
+					{
+						total += static_cast<std::size_t>(search(vec, static_cast<T>(query)) - vec.begin());
+					}
+					sink = sink + total;
+				}) / lookups;
+			};
+
+			print_row(size,
+				lookup_ns([](const auto& vec, T value) { return linear_lower_bound(vec, value); }),
+				lookup_ns([](const auto& vec, T value) { return branchless_lower_bound(vec, value); }));
+		}
+	}
+
+	void lower_bound_benchmark()
+	{
+		lower_bound_rows<std::uint32_t>("uint32_t");
+		lower_bound_rows<std::uint64_t>("uint64_t");
+		lower_bound_rows<double>("double");
+	}
+
+	struct level
+	{
+		double price;
+		double quantity;
+	};
+
+	using level_book = static_vector<level, 64>;
+
+	struct seqlock_book
+	{
+		seqlock_static_vector<level, 64> levels;
+
+		explicit seqlock_book(const level_book& initial) : levels{ initial } {}
+
+		void write(std::size_t tick)
+		{
+			levels.update([&](level_book& book) { book[tick % book.size()].quantity = static_cast<double>(tick); });
+		}
+
+		void read(level_book& out) const
+		{
+			levels.read_into(out);
+		}
+	};
+
+	struct shared_mutex_book
+	{
+		mutable std::shared_mutex mutex;
+		level_book levels;
+
+		explicit shared_mutex_book(const level_book& initial) : levels{ initial } {}
+
+		void write(std::size_t tick)
+		{
+			const std::unique_lock lock{ mutex };
+			levels[tick % levels.size()].quantity = static_cast<double>(tick);
+		}
+
+		void read(level_book& out) const
+		{
+			const std::shared_lock lock{ mutex };
+			out = levels;
+		}
+	};
+
+	template<typename Book>
+	double snapshot_read_ns(const level_book& initial, std::size_t readers)
+	{
+		constexpr std::size_t reads_per_thread = 20000;
+
+		return best_ns([&]
+		{
+			Book book{ initial };
+			std::jthread writer{ [&](std::stop_token stop)
+			{
+				for (std::size_t tick = 0; not stop.stop_requested(); ++tick)
+				{
+					book.write(tick);
+				}
+			} };
+
+			std::vector<std::jthread> threads;
+			for (std::size_t i = 0; i != readers; ++i)
+			{
+				threads.emplace_back([&]
+				{
+					level_book out;
+					double total = 0.0;
+					for (std::size_t read = 0; read != reads_per_thread; ++read)
+					{
+						book.read(out);
+						total += out[read % out.size()].quantity;
+					}
+					sink = sink + static_cast<std::uint64_t>(total);
+				});
+			}
+		}) / static_cast<double>(readers * reads_per_thread);
+	}
+
+	void snapshot_benchmark()
+	{
+		level_book initial;
+		for (std::size_t i = 0; i != initial.capacity(); ++i)
+		{
+			initial.push_back(level{ 100.0 + static_cast<double>(i), 1.0 });
+		}
+
+		std::cout << "64-level snapshot reads with one busy writer, wall time per read\n";
+		print_header("readers", "seqlock ns", "shared_mutex ns");
+
+		for (const std::size_t readers : { 1uz, 2uz, 4uz, 8uz, 16uz, 32uz, 64uz })
+		{
+			print_row(readers, snapshot_read_ns<seqlock_book>(initial, readers),
+				snapshot_read_ns<shared_mutex_book>(initial, readers));
+		}
+	}
+
+	template<std::size_t BatchSize, typename Range>
+	double vector_chunks_ns(Range&& range)
+	{
+		return best_ns([&]
+		{
+			std::uint64_t total = 0;
+#if defined(__cpp_lib_ranges_chunk)
+			for (auto&& chunk : range | std::views::chunk(BatchSize))
+			{
+				const std::vector<int> block(std::ranges::begin(chunk), std::ranges::end(chunk));
+				total += static_cast<std::uint64_t>(std::accumulate(block.begin(), block.end(), 0LL));
+			}
+#else
+			auto it = std::ranges::begin(range);
+			while (it != std::ranges::end(range))
+			{
+				std::vector<int> block;
+				block.reserve(BatchSize);
+				for (std::size_t i = 0; i != BatchSize && it != std::ranges::end(range); ++i, ++it)
+				{
+					block.push_back(*it);
+				}
+				total += static_cast<std::uint64_t>(std::accumulate(block.begin(), block.end(), 0LL));
+			}
+#endif
+			sink = sink + total;
+		});
+	}
+
+	template<std::size_t BatchSize, typename Range>
+	double static_chunks_ns(Range&& range)
+	{
+		return best_ns([&]
+		{
+			std::uint64_t total = 0;
+			for (const auto& block : range | views::chunk_static<BatchSize>)
+			{
+				total += static_cast<std::uint64_t>(std::accumulate(block.begin(), block.end(), 0LL));
+			}
+			sink = sink + total;
+		});
+	}
+
+	template<std::size_t ... BatchSizes>
+	void chunk_rows(std::string_view source_name, auto&& range)
+	{
+		std::cout << "blocks of " << source_name << '\n';
+		print_header("batch", "chunk_static ns", "chunk + vector ns");
+		(print_row(BatchSizes, static_chunks_ns<BatchSizes>(range), vector_chunks_ns<BatchSizes>(range)), ...);
+	}
+
+	void chunk_benchmark()
+	{
+		constexpr int count = 1 << 20;
+		const std::vector<int> values = random_values(count);
+		const std::deque<int> deque(values.begin(), values.end());
+
+		chunk_rows<16, 256, 4096>("a std::deque<int> of 2^20 elements", deque);
+		chunk_rows<16, 256, 4096>("a transform over iota(0, 2^20)",
+			std::views::iota(0, count) | std::views::transform([](int i) { return i * 3 + 1; }));
+	}
+
+	struct benchmark_entry
+	{
+		std::string_view name;
+		void (*run)();
+	};
+
+	constexpr std::array benchmarks{
+		benchmark_entry{ "insert_range", &insert_range_benchmark },
+		benchmark_entry{ "priority_queue", &priority_queue_benchmark },
+		benchmark_entry{ "parallel", &parallel_benchmark },
+		benchmark_entry{ "sorted_insert", &sorted_insert_benchmark },
+		benchmark_entry{ "lower_bound", &lower_bound_benchmark },
+		benchmark_entry{ "snapshot", &snapshot_benchmark },
+		benchmark_entry{ "chunk", &chunk_benchmark }
+	};
+}
+
+int main(int argc, char** argv)
+{
+	const std::string_view only = argc > 1 ? argv[1] : "";
+
+	for (const benchmark_entry& entry : benchmarks)
+	{
+		if (only.empty() || only == entry.name)
+		{
+			std::cout << "== " << entry.name << '\n';
+			entry.run();
+		}
+	}
+}
@@ -0,0 +1,33 @@
+#include <cstddef>
+#include <string>
+#include <utility>
+
+#include "static_vector.hpp"
+
+#ifndef STATIC_VECTOR_CONSTEXPR_CAPACITY
+#define STATIC_VECTOR_CONSTEXPR_CAPACITY 1000
+#endif
+
+constexpr std::size_t capacity = STATIC_VECTOR_CONSTEXPR_CAPACITY;
+constexpr std::size_t string_count = capacity / 10;
+
+constexpr bool construct_and_destroy()
+{
+	static_vector<int, capacity> filled(capacity, 7);
+	static_vector<int, capacity> zeroed(capacity);
+	static_vector<int, capacity> copied = filled;
+	static_vector<int, capacity> moved = std::move(copied);
+
+	static_vector<std::string, string_count> strings(string_count, "value");
+	static_vector<std::string, string_count> copies = strings;
+	static_vector<std::string, string_count> sized(string_count);
+
+	return filled.size() + zeroed.size() + moved.size() == 3 * capacity
+		&& copies.size() + sized.size() == 2 * string_count;
+}
+
+static_assert(construct_and_destroy());
+
+int main()
+{
+}
@@ -0,0 +1,44 @@
+#!/bin/sh
+# Records the compile time and the smallest constexpr step limit that lets
+# constexpr_benchmark.cpp compile, at 1K, 10K and 100K element capacities.
+# Usage: CXX=clang++ ./constexpr_benchmark.sh
+
+CXX=${CXX:-g++}
+CXXFLAGS=${CXXFLAGS:--std=c++23}
+SOURCE=$(dirname "$0")/constexpr_benchmark.cpp
+
+case $("$CXX" --version) in
+	*clang*) STEPS_FLAG=-fconstexpr-steps ;;
+	*) STEPS_FLAG=-fconstexpr-ops-limit ;;
+esac
+
+compiles()
+{
+	"$CXX" $CXXFLAGS -fsyntax-only -DSTATIC_VECTOR_CONSTEXPR_CAPACITY="$1" "$STEPS_FLAG=$2" "$SOURCE" 2>/dev/null
+}
+
+printf '%-10s %14s %12s\n' capacity steps seconds
+
+for capacity in 1000 10000 100000; do
+	low=1
+	high=2000000000
+	if ! compiles "$capacity" "$high"; then
+		printf '%-10s %14s %12s\n' "$capacity" failed -
+		continue
+	fi
+
+	while [ $((high - low)) -gt $((low / 100 + 1)) ]; do
+		middle=$(((low + high) / 2))
+		if compiles "$capacity" "$middle"; then
+			high=$middle
+		else
+			low=$middle
+		fi
+	done
+
+	start=$(date +%s.%N)
+	compiles "$capacity" 2000000000
+	end=$(date +%s.%N)
+
+	printf '%-10s %14s %12.2f\n' "$capacity" "$high" "$(awk "BEGIN { print $end - $start }")"
+done
@@ -0,0 +1,641 @@
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+#include <vector>
+
+#include "static_vector.hpp"
+
+namespace
+{
+	enum class operation : std::uint8_t
+	{
+		push_back, emplace, pop_back, insert, insert_count, insert_range, append_range,
+		erase, erase_range, resize, resize_value, assign_count, assign_range, clear,
+		copy_assign, move_assign, swap, assign_other, inspect,
+		push_back_alias, emplace_alias, insert_alias, insert_count_alias, count
+	};
+
+	constexpr std::size_t operation_count = static_cast<std::size_t>(operation::count);
+
+	constexpr std::array<const char*, operation_count> operation_names{
+		"push_back", "emplace", "pop_back", "insert", "insert_count", "insert_range", "append_range",
+		"erase", "erase_range", "resize", "resize_value", "assign_count", "assign_range", "clear",
+		"copy_assign", "move_assign", "swap", "assign_other", "inspect",
+		"push_back_alias", "emplace_alias", "insert_alias", "insert_count_alias"
+	};
+
+	enum class guarantee : std::uint8_t
+	{
+		basic, strong
+	};
+
+	struct op_stats
+	{
+		std::uint64_t calls = 0;
+		std::chrono::nanoseconds static_time{};
+		std::chrono::nanoseconds std_time{};
+	};
+
+	using stats_table = std::array<op_stats, operation_count>;
+
+	constexpr std::uint64_t min_timed_calls = 1000;
+
+	struct injected_failure : std::runtime_error
+	{
+		injected_failure()
+			: std::runtime_error{ "injected failure" }
+		{
+		}
+	};
+
+	struct throwing_value
+	{
+		static inline long live = 0;
+		static inline int countdown = -1;
+
+		int value;
+
+		throwing_value()
+			: throwing_value(0)
+		{
+		}
+
+		throwing_value(int v)
+			: value{ v }
+		{
+			maybe_throw();
+			++live;
+		}
+
+		throwing_value(const throwing_value& other)
+			: value{ other.value }
+		{
+			maybe_throw();
+			++live;
+		}
+
+		throwing_value(throwing_value&& other)
+			: value{ other.value }
+		{
+			maybe_throw();
+			++live;
+		}
+
+		throwing_value& operator=(const throwing_value& other)
+		{
+			maybe_throw();
+			value = other.value;
+			return *this;
+		}
+
+		throwing_value& operator=(throwing_value&& other)
+		{
+			maybe_throw();
+			value = other.value;
+			return *this;
+		}
+
+		~throwing_value()
+		{
+			--live;
+		}
+
+		friend bool operator==(const throwing_value&, const throwing_value&) = default;
+
+		static void maybe_throw()
+		{
+			if (countdown >= 0 && countdown-- == 0)
+			{
+				throw injected_failure{};
+			}
+		}
+	};
+
+	class byte_source
+	{
+	public:
+		explicit byte_source(std::span<const std::uint8_t> bytes) noexcept
+			: bytes_{ bytes }
+		{
+		}
+
+		bool empty() const noexcept
+		{
+			return bytes_.empty();
+		}
+
+		std::uint8_t next() noexcept
+		{
+			if (bytes_.empty())
+			{
+				return 0;
+			}
+
+			const std::uint8_t byte = bytes_.front();
+			bytes_ = bytes_.subspan(1);
+			return byte;
+		}
+
+		std::size_t below(std::size_t bound) noexcept
+		{
+			return bound == 0 ? 0 : next() % bound;
+		}
+
+	private:
+		std::span<const std::uint8_t> bytes_;
+	};
+
+	template<typename T>
+	T make_value(std::uint8_t byte)
+	{
+		if constexpr (std::is_same_v<T, std::string>)
+		{
+			return std::string(byte % 40, static_cast<char>('a' + byte % 26));
+		}
+		else
+		{
+			return T(byte);
+		}
+	}
+
+	template<typename T, std::size_t Capacity>
+	class differential_run
+	{
+	public:
+		explicit differential_run(stats_table& stats) noexcept
+			: stats_{ stats }
+		{
+		}
+
+		void run(byte_source& source)
+		{
+			while (not source.empty())
+			{
+				const auto op = static_cast<operation>(source.next() % operation_count);
+				step(op, source);
+				verify(op);
+			}
+		}
+
+	private:
+		void step(operation op, byte_source& source)
+		{
+			const std::size_t size = actual_.size();
+
+			switch (op)
+			{
+			case operation::push_back:
+			{
+				const T value = make_value<T>(source.next());
+				apply(op, source, size + 1 <= Capacity, guarantee::strong,
+					[&] { actual_.push_back(value); }, [&] { expected_.push_back(value); });
+				break;
+			}
+			case operation::emplace:
+			{
+				const std::size_t pos = source.below(size + 1);
+				const T value = make_value<T>(source.next());
+				apply(op, source, size + 1 <= Capacity, at_end(pos),
+					[&] { actual_.emplace(actual_.begin() + pos, value); },
+					[&] { expected_.emplace(expected_.begin() + pos, value); });
+				break;
+			}
+			case operation::pop_back:
+				if (size != 0)
+				{
+					apply(op, source, true, guarantee::strong,
+						[&] { actual_.pop_back(); }, [&] { expected_.pop_back(); });
+				}
+				break;
+			case operation::insert:
+			{
+				const std::size_t pos = source.below(size + 1);
+				const T value = make_value<T>(source.next());
+				apply(op, source, size + 1 <= Capacity, at_end(pos),
+					[&] { actual_.insert(actual_.begin() + pos, value); },
+					[&] { expected_.insert(expected_.begin() + pos, value); });
+				break;
+			}
+			case operation::insert_count:
+			{
+				const std::size_t pos = source.below(size + 1);
+				const std::size_t count = source.below(6);
+				const T value = make_value<T>(source.next());
+				apply(op, source, size + count <= Capacity, at_end(pos),
+					[&] { actual_.insert(actual_.begin() + pos, count, value); },
+					[&] { expected_.insert(expected_.begin() + pos, count, value); });
+				break;
+			}
+			case operation::insert_range:
+			{
+				const std::size_t pos = source.below(size + 1);
+				const std::vector<T> items = make_items(source, 6);
+				apply(op, source, size + items.size() <= Capacity, at_end(pos),
+					[&] { actual_.insert_range(actual_.begin() + pos, items); },
+					[&] { expected_.insert(expected_.begin() + pos, items.begin(), items.end()); });
+				break;
+			}
+			case operation::append_range:
+			{
+				const std::vector<T> items = make_items(source, 6);
+				apply(op, source, size + items.size() <= Capacity, guarantee::strong,
+					[&] { actual_.append_range(items); },
+					[&] { expected_.insert(expected_.end(), items.begin(), items.end()); });
+				break;
+			}
+			case operation::erase:
+				if (size != 0)
+				{
+					const std::size_t pos = source.below(size);
+					apply(op, source, true, guarantee::basic,
+						[&] { actual_.erase(actual_.begin() + pos); },
+						[&] { expected_.erase(expected_.begin() + pos); });
+				}
+				break;
+			case operation::erase_range:
+			{
+				const std::size_t first = source.below(size + 1);
+				const std::size_t last = first + source.below(size - first + 1);
+				apply(op, source, true, guarantee::basic,
+					[&] { actual_.erase(actual_.begin() + first, actual_.begin() + last); },
+					[&] { expected_.erase(expected_.begin() + first, expected_.begin() + last); });
+				break;
+			}
+			case operation::resize:
+			{
+				const std::size_t count = source.below(Capacity + 4);
+				apply(op, source, count <= Capacity, guarantee::strong,
+					[&] { actual_.resize(count); }, [&] { expected_.resize(count); });
+				break;
+			}
+			case operation::resize_value:
+			{
+				const std::size_t count = source.below(Capacity + 4);
+				const T value = make_value<T>(source.next());
+				apply(op, source, count <= Capacity, guarantee::strong,
+					[&] { actual_.resize(count, value); }, [&] { expected_.resize(count, value); });
+				break;
+			}
+			case operation::assign_count:
+			{
+				const std::size_t count = source.below(Capacity + 4);
+				const T value = make_value<T>(source.next());
+				apply(op, source, count <= Capacity, guarantee::basic,
+					[&] { actual_.assign(count, value); }, [&] { expected_.assign(count, value); });
+				break;
+			}
+			case operation::assign_range:
+			{
+				const std::vector<T> items = make_items(source, Capacity + 4);
+				apply(op, source, items.size() <= Capacity, guarantee::basic,
+					[&] { actual_.assign_range(items); },
+					[&] { expected_.assign(items.begin(), items.end()); });
+				break;
+			}
+			case operation::clear:
+				apply(op, source, true, guarantee::strong, [&] { actual_.clear(); }, [&] { expected_.clear(); });
+				break;
+			case operation::copy_assign:
+				apply(op, source, true, guarantee::basic,
+					[&] { actual_ = other_actual_; }, [&] { expected_ = other_expected_; });
+				break;
+			case operation::move_assign:
+				apply(op, source, true, guarantee::basic,
+					[&]
+					{
+						actual_ = std::move(other_actual_);
+						other_actual_.clear();
+					},
+					[&]
+					{
+						expected_ = std::move(other_expected_);
+						other_expected_.clear();
+					});
+				break;
+			case operation::swap:
+				apply(op, source, true, guarantee::basic,
+					[&] { actual_.swap(other_actual_); }, [&] { expected_.swap(other_expected_); });
+				break;
+			case operation::assign_other:
+			{
+				const std::vector<T> items = make_items(source, Capacity + 1);
+				apply(op, source, items.size() <= Capacity, guarantee::basic,
+					[&] { other_actual_.assign_range(items); },
+					[&] { other_expected_.assign(items.begin(), items.end()); });
+				break;
+			}
+			case operation::inspect:
+				inspect(op);
+				break;
+			case operation::push_back_alias:
+				if (size != 0)
+				{
+					const std::size_t from = source.below(size);
+					apply(op, source, size + 1 <= Capacity, guarantee::strong,
+						[&] { actual_.push_back(actual_[from]); }, [&] { expected_.push_back(expected_[from]); });
+				}
+				break;
+			case operation::emplace_alias:
+				if (size != 0)
+				{
+					const std::size_t pos = source.below(size + 1);
+					const std::size_t from = source.below(size);
+					apply(op, source, size + 1 <= Capacity, at_end(pos),
+						[&] { actual_.emplace(actual_.begin() + pos, actual_[from]); },
+						[&] { expected_.emplace(expected_.begin() + pos, expected_[from]); });
+				}
+				break;
+			case operation::insert_alias:
+				if (size != 0)
+				{
+					const std::size_t pos = source.below(size + 1);
+					const std::size_t from = source.below(size);
+					apply(op, source, size + 1 <= Capacity, at_end(pos),
+						[&] { actual_.insert(actual_.begin() + pos, actual_[from]); },
+						[&] { expected_.insert(expected_.begin() + pos, expected_[from]); });
+				}
+				break;
+			case operation::insert_count_alias:
+				if (size != 0)
+				{
+					const std::size_t pos = source.below(size + 1);
+					const std::size_t count = source.below(6);
+					const std::size_t from = source.below(size);
+					apply(op, source, size + count <= Capacity, at_end(pos),
+						[&] { actual_.insert(actual_.begin() + pos, count, actual_[from]); },
+						[&] { expected_.insert(expected_.begin() + pos, count, expected_[from]); });
+				}
+				break;
+			case operation::count:
+				break;
+			}
+		}
+
+		guarantee at_end(std::size_t pos) const noexcept
+		{
+			return pos == actual_.size() ? guarantee::strong : guarantee::basic;
+		}
+
+		void inspect(operation op)
+		{
+			++stats_[static_cast<std::size_t>(op)].calls;
+
+			const auto& view = std::as_const(actual_);
+			check(std::ranges::equal(actual_.rbegin(), actual_.rend(), expected_.rbegin(), expected_.rend())
+				&& std::ranges::equal(view.rbegin(), view.rend(), expected_.rbegin(), expected_.rend())
+				&& std::ranges::equal(view.crbegin(), view.crend(), expected_.crbegin(), expected_.crend()),
+				op, "reverse iteration diverged from std::vector");
+
+			if (not expected_.empty())
+			{
+				check(actual_.front() == expected_.front() && view.front() == expected_.front()
+					&& actual_.back() == expected_.back() && view.back() == expected_.back()
+					&& &actual_.front() == actual_.data() && &view.back() == view.data() + view.size() - 1
+					&& actual_.at(actual_.size() - 1) == expected_.back(),
+					op, "element accessors diverged from std::vector");
+			}
+		}
+
+		template<typename StaticOp, typename StdOp>
+		void apply(operation op, byte_source& source, bool fits, guarantee level, StaticOp static_op, StdOp std_op)
+		{
+			op_stats& stats = stats_[static_cast<std::size_t>(op)];
+			++stats.calls;
+
+			if (not fits)
+			{
+				bool threw = false;
+				try
+				{
+					static_op();
+				}
+				catch (const std::length_error&)
+				{
+					threw = true;
+				}
+				check(threw, op, "expected std::length_error when exceeding capacity");
+				return;
+			}
+
+			const int countdown = draw_countdown(source);
+			std::vector<T> before;
+			std::vector<T> other_before;
+			if (countdown >= 0)
+			{
+				before.assign(actual_.begin(), actual_.end());
+				other_before.assign(other_actual_.begin(), other_actual_.end());
+			}
+
+			const auto std_start = std::chrono::steady_clock::now();
+			std_op();
+			stats.std_time += std::chrono::steady_clock::now() - std_start;
+
+			arm_injection(countdown);
+			try
+			{
+				const auto static_start = std::chrono::steady_clock::now();
+				static_op();
+				stats.static_time += std::chrono::steady_clock::now() - static_start;
+			}
+			catch (const injected_failure&)
+			{
+				disarm_injection();
+				if (level == guarantee::strong)
+				{
+					check(std::ranges::equal(actual_, before) && std::ranges::equal(other_actual_, other_before),
+						op, "failed operation broke the strong exception guarantee");
+				}
+				check(actual_.size() <= Capacity && other_actual_.size() <= Capacity,
+					op, "failed operation broke the basic exception guarantee");
+
+				expected_.assign(actual_.begin(), actual_.end());
+				other_expected_.assign(other_actual_.begin(), other_actual_.end());
+				return;
+			}
+			disarm_injection();
+		}
+
+		void verify(operation op)
+		{
+			check(actual_.size() == expected_.size() && std::ranges::equal(actual_, expected_),
+				op, "static_vector diverged from std::vector");
+			check(other_actual_.size() == other_expected_.size()
+				&& std::ranges::equal(other_actual_, other_expected_),
+				op, "second static_vector diverged from std::vector");
+			check(actual_.size() <= Capacity && other_actual_.size() <= Capacity, op, "size exceeds capacity");
+			check_live_objects(op);
+		}
+
+		void check_live_objects(operation op)
+		{
+			if constexpr (std::is_same_v<T, throwing_value>)
+			{
+				const auto tracked = static_cast<long>(actual_.size() + expected_.size()
+					+ other_actual_.size() + other_expected_.size());
+				check(throwing_value::live == tracked, op, "constructed and destroyed element counts do not match");
+			}
+		}
+
+		int draw_countdown(byte_source& source)
+		{
+			if constexpr (std::is_same_v<T, throwing_value>)
+			{
+				return source.next() % 4 == 0 ? static_cast<int>(source.below(4)) : -1;
+			}
+			else
+			{
+				return -1;
+			}
+		}
+
+		void arm_injection(int countdown)
+		{
+			if constexpr (std::is_same_v<T, throwing_value>)
+			{
+				throwing_value::countdown = countdown;
+			}
+		}
+
+		void disarm_injection()
+		{
+			if constexpr (std::is_same_v<T, throwing_value>)
+			{
+				throwing_value::countdown = -1;
+			}
+		}
+
+		std::vector<T> make_items(byte_source& source, std::size_t max_count)
+		{
+			std::vector<T> items;
+			for (std::size_t count = source.below(max_count + 1); count != 0; --count)
+			{
+				items.push_back(make_value<T>(source.next()));
+			}
+			return items;
+		}
+
+		void check(bool condition, operation op, const char* what) const
+		{
+			if (not condition)
+			{
+				std::cerr << "differential failure after " << operation_names[static_cast<std::size_t>(op)]
+					<< " on static_vector<" << typeid(T).name() << ", " << Capacity << ">: " << what
+					<< " (sizes " << actual_.size() << " vs " << expected_.size() << ")\n";
+				std::abort();
+			}
+		}
+
+		stats_table& stats_;
+		static_vector<T, Capacity> actual_;
+		static_vector<T, Capacity> other_actual_;
+		std::vector<T> expected_;
+		std::vector<T> other_expected_;
+	};
+
+	void run_all(std::span<const std::uint8_t> bytes, stats_table& stats)
+	{
+		{
+			byte_source source{ bytes };
+			differential_run<int, 16>{ stats }.run(source);
+		}
+		{
+			byte_source source{ bytes };
+			differential_run<std::string, 16>{ stats }.run(source);
+		}
+		{
+			byte_source source{ bytes };
+			differential_run<throwing_value, 16>{ stats }.run(source);
+		}
+	}
+
+	void print_stats(const stats_table& stats)
+	{
+		std::cout << std::left << std::setw(14) << "operation" << std::right << std::setw(10) << "calls"
+			<< std::setw(18) << "static_vector ns" << std::setw(18) << "std::vector ns" << '\n';
+
+		for (std::size_t i = 0; i != operation_count; ++i)
+		{
+			const op_stats& op = stats[i];
+			const double calls = static_cast<double>(std::max<std::uint64_t>(op.calls, 1));
+
+			std::cout << std::left << std::setw(14) << operation_names[i] << std::right << std::setw(10) << op.calls
+				<< std::fixed << std::setprecision(1)
+				<< std::setw(18) << static_cast<double>(op.static_time.count()) / calls
+				<< std::setw(18) << static_cast<double>(op.std_time.count()) / calls << '\n';
+		}
+	}
+
+	constexpr bool comparable_timing(operation op) noexcept
+	{
+		return op != operation::inspect && op != operation::move_assign && op != operation::swap;
+	}
+
+	bool within_ratio(const stats_table& stats, double max_ratio)
+	{
+		bool within = true;
+		for (std::size_t i = 0; i != operation_count; ++i)
+		{
+			const op_stats& op = stats[i];
+			if (not comparable_timing(static_cast<operation>(i)) || op.calls < min_timed_calls
+				|| op.std_time.count() == 0)
+			{
+				continue;
+			}
+
+			const double ratio = static_cast<double>(op.static_time.count()) / static_cast<double>(op.std_time.count());
+			if (ratio > max_ratio)
+			{
+				std::cerr << "performance regression in " << operation_names[i] << ": static_vector took "
+					<< ratio << "x the time of std::vector, above the limit of " << max_ratio << "x\n";
+				within = false;
+			}
+		}
+		return within;
+	}
+}
+
+#ifdef STATIC_VECTOR_LIBFUZZER
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size)
+{
+	stats_table stats{};
+	run_all(std::span{ data, size }, stats);
+	return 0;
+}
+
+#else
+
+int main(int argc, char** argv)
+{
+	const unsigned long iterations = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 2000;
+	const unsigned long seed = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 20240601;
+	const double max_ratio = argc > 3 ? std::strtod(argv[3], nullptr) : 0.0;
+
+	std::mt19937 engine{ static_cast<std::mt19937::result_type>(seed) };
+	std::uniform_int_distribution<int> byte_distribution{ 0, 255 };
+
+	stats_table stats{};
+	std::vector<std::uint8_t> bytes(512);
+
+	for (unsigned long i = 0; i != iterations; ++i)
+	{
+		std::ranges::generate(bytes, [&] { return static_cast<std::uint8_t>(byte_distribution(engine)); });
+		run_all(bytes, stats);
+	}
+
+	print_stats(stats);
+
+	return max_ratio > 0.0 && not within_ratio(stats, max_ratio) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
+
+#endif
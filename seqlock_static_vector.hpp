@@ -0,0 +1,154 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <type_traits>
+
+#include "static_vector.hpp"
+
+template<typename T, std::size_t Capacity>
+class seqlock_static_vector
+{
+	static_assert(std::is_trivially_copyable_v<T>,
+		"seqlock_static_vector copies elements bytewise and requires a trivially copyable type");
+
+private:
+	using word_t = std::uint64_t;
+	using real_size_t = detail::smallest_size_type_t<Capacity>;
+
+	static constexpr std::size_t word_count = (Capacity * sizeof(T) + sizeof(word_t) - 1) / sizeof(word_t);
+
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+	using vector_type = static_vector<T, Capacity>;
+
+	seqlock_static_vector() noexcept = default;
+
+	explicit seqlock_static_vector(const vector_type& initial) noexcept
+	{
+		store(initial);
+	}
+
+	seqlock_static_vector(const seqlock_static_vector&) = delete;
+	seqlock_static_vector& operator=(const seqlock_static_vector&) = delete;
+
+	void read_into(vector_type& out) const noexcept
+	{
+		while (true)
+		{
+			const std::uint64_t sequence = sequence_.load(std::memory_order_acquire);
+			if (sequence % 2 != 0)
+			{
+				continue;
+			}
+
+			const size_type count = size_.load(std::memory_order_relaxed);
+			out.resize_and_overwrite(count, [&](T* data, size_type)
+				{
+					load_bytes(reinterpret_cast<std::byte*>(data), count * sizeof(T));
+					return count;
+				});
+
+			std::atomic_thread_fence(std::memory_order_acquire);
+			if (sequence_.load(std::memory_order_relaxed) == sequence)
+			{
+				return;
+			}
+		}
+	}
+
+	vector_type snapshot() const noexcept
+	{
+		vector_type out;
+		read_into(out);
+		return out;
+	}
+
+	void store(const vector_type& values) noexcept
+	{
+		if (std::addressof(values) != std::addressof(staging_))
+		{
+			staging_ = values;
+		}
+		publish();
+	}
+
+	template<typename Function>
+		requires std::invocable<Function&, vector_type&>
+	void update(Function fn)
+	{
+		std::invoke(fn, staging_);
+		publish();
+	}
+
+	const vector_type& writer_view() const noexcept
+	{
+		return staging_;
+	}
+
+	std::uint64_t version() const noexcept
+	{
+		return sequence_.load(std::memory_order_acquire) / 2;
+	}
+
+	static constexpr size_type capacity() noexcept
+	{
+		return Capacity;
+	}
+
+private:
+	void publish() noexcept
+	{
+		const std::uint64_t sequence = sequence_.load(std::memory_order_relaxed);
+		sequence_.store(sequence + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+
+		store_bytes(reinterpret_cast<const std::byte*>(staging_.data()), staging_.size() * sizeof(T));
+		size_.store(static_cast<real_size_t>(staging_.size()), std::memory_order_relaxed);
+
+		sequence_.store(sequence + 2, std::memory_order_release);
+	}
+
+	void load_bytes(std::byte* destination, size_type bytes) const noexcept
+	{
+		const size_type full_words = bytes / sizeof(word_t);
+		for (size_type i = 0; i != full_words; ++i)
+		{
+			const word_t word = words_[i].load(std::memory_order_relaxed);
+			std::memcpy(destination + i * sizeof(word_t), &word, sizeof(word_t));
+		}
+
+		if (const size_type remainder = bytes % sizeof(word_t); remainder != 0)
+		{
+			const word_t word = words_[full_words].load(std::memory_order_relaxed);
+			std::memcpy(destination + full_words * sizeof(word_t), &word, remainder);
+		}
+	}
+
+	void store_bytes(const std::byte* source, size_type bytes) noexcept
+	{
+		const size_type full_words = bytes / sizeof(word_t);
+		for (size_type i = 0; i != full_words; ++i)
+		{
+			word_t word;
+			std::memcpy(&word, source + i * sizeof(word_t), sizeof(word_t));
+			words_[i].store(word, std::memory_order_relaxed);
+		}
+
+		if (const size_type remainder = bytes % sizeof(word_t); remainder != 0)
+		{
+			word_t word = 0;
+			std::memcpy(&word, source + full_words * sizeof(word_t), remainder);
+			words_[full_words].store(word, std::memory_order_relaxed);
+		}
+	}
+
+	alignas(64) std::atomic<std::uint64_t> sequence_{ 0 };
+	std::atomic<real_size_t> size_{ 0 };
+	std::array<std::atomic<word_t>, word_count> words_{};
+	alignas(64) vector_type staging_;
+};
@@ -1,13 +1,36 @@
 #include <iostream>
 #include <string>
+#include <sstream>
 #include <numeric>
 #include <vector>
+#include <deque>
+#include <coroutine>
+#include <memory_resource>
 #include <algorithm>
 #include <ranges>
+#include <cstdio>
 
 #include <cassert>
 
+#if __has_include(<sys/uio.h>)
+#include <unistd.h>
+#endif
+
 #include "static_vector.hpp"
+#include "static_slot_map.hpp"
+#include "static_priority_queue.hpp"
+#include "static_arena_resource.hpp"
+#include "static_object_pool.hpp"
+#include "static_bitvector.hpp"
+#include "static_jagged_vector.hpp"
+#include "static_matrix.hpp"
+#include "static_vector_parallel.hpp"
+#include "static_vector_io.hpp"
+#include "static_buffer_ring.hpp"
+#include "static_vector_search.hpp"
+#include "seqlock_static_vector.hpp"
+#include "atomic_static_vector_publisher.hpp"
+#include "static_vector_batching.hpp"
 
 
 template<std::size_t Size>
@@ -349,6 +372,1120 @@ constexpr bool test_16()
 	return std::ranges::equal(vec, expected);
 }
 
+constexpr bool test_17()
+{
+	using namespace std::literals;
+
+	static_vector<std::string, 20> vec;
+	std::vector <std::string> expected;
+
+	vec.emplace_back("string 0");
+	vec.emplace_back("string 1");
+	expected.emplace_back("string 0");
+	expected.emplace_back("string 1");
+
+	vec.insert(vec.begin() + 1, { "{    }"s, "{    }"s, "{    }"s });
+	expected.insert(expected.begin() + 1, { "{    }"s, "{    }"s, "{    }"s });
+
+	vec.emplace(vec.begin() + 2, 5, 'x');
+	expected.emplace(expected.begin() + 2, 5, 'x');
+
+	vec.insert(vec.end() - 1, 4, "[    ]"s);
+	expected.insert(expected.end() - 1, 4, "[    ]"s);
+
+	return std::ranges::equal(vec, expected);
+}
+
+constexpr bool test_18()
+{
+	static_vector<int, 20> vec{ 1, 2, 3 };
+	std::vector<int> expected{ 1, 2, 3 };
+
+	vec.emplace(vec.begin(), 0);
+	expected.emplace(expected.begin(), 0);
+
+	vec.insert(vec.begin() + 2, 5, 7);
+	expected.insert(expected.begin() + 2, 5, 7);
+
+	vec.insert(vec.end() - 1, { 8, 9 });
+	expected.insert(expected.end() - 1, { 8, 9 });
+
+	return std::ranges::equal(vec, expected);
+}
+
+bool test_19()
+{
+	std::istringstream stream{ "1 2 3 4 5" };
+	auto doubled = std::views::istream<int>(stream)
+		| std::views::transform([](int i) { return i * 2; });
+
+	static_vector<int, 20> vec{ 0, 100, 200 };
+	std::vector<int> expected{ 0, 2, 4, 6, 8, 10, 100, 200 };
+
+	const auto it = vec.insert_range(vec.begin() + 1, doubled);
+
+	return it == vec.begin() + 1 && std::ranges::equal(vec, expected);
+}
+
+constexpr bool test_20()
+{
+	using namespace std::literals;
+
+	const static_vector<std::string, 10> lhs{ "a"s, "b"s, "c"s };
+	const static_vector<std::string, 20> rhs{ "a"s, "b"s, "d"s };
+	const static_vector<unsigned char, 10> bytes_1{ 1, 2, 3 };
+	const static_vector<unsigned char, 10> bytes_2{ 1, 2, 3, 0 };
+
+	return lhs == lhs && lhs != rhs && lhs < rhs && (rhs <=> lhs) > 0
+		&& bytes_1 < bytes_2 && bytes_1 == static_vector<unsigned char, 10>{ 1, 2, 3 };
+}
+
+bool test_21()
+{
+	using namespace std::literals;
+
+	const static_vector<int, 10> ints_1{ 1, 2, 3 };
+	const static_vector<int, 10> ints_2{ 1, 2, 3 };
+	const static_vector<std::string, 10> strings_1{ "a"s, "b"s };
+	const static_vector<std::string, 10> strings_2{ "a"s, "b"s };
+	const static_vector<unsigned char, 10> bytes_1{ 1, 2, 3 };
+	const static_vector<unsigned char, 10> bytes_2{ 1, 2, 4 };
+
+	return ints_1 == ints_2
+		&& std::hash<static_vector<int, 10>>{}(ints_1) == std::hash<static_vector<int, 10>>{}(ints_2)
+		&& std::hash<static_vector<std::string, 10>>{}(strings_1)
+			== std::hash<static_vector<std::string, 10>>{}(strings_2)
+		&& bytes_1 < bytes_2 && (bytes_2 <=> bytes_1) > 0;
+}
+
+constexpr bool test_22()
+{
+	using namespace std::literals;
+
+	static_slot_map<std::string, 8> map;
+
+	const auto a = map.insert("a"s);
+	const auto b = map.emplace("b");
+	const auto c = map.emplace(1, 'c');
+
+	if (not map.erase(b) || map.erase(b) || map.contains(b) || map.find(b) != nullptr)
+	{
+		return false;
+	}
+
+	const auto d = map.emplace("d");
+
+	if (d.index != b.index || d == b || map.contains(b))
+	{
+		return false;
+	}
+
+	map.erase(a);
+
+	std::vector<std::string> values(map.begin(), map.end());
+	std::ranges::sort(values);
+
+	return map.size() == 2 && map[c] == "c" && map.at(d) == "d"
+		&& map.handle_of(map.begin() + 1) == (map[c] == map.begin()[1] ? c : d)
+		&& values == std::vector{ "c"s, "d"s };
+}
+
+template<std::size_t Arity>
+constexpr bool test_23()
+{
+	const std::array values{ 5, 1, 9, 3, 7, 2, 8, 6, 4, 0 };
+
+	static_priority_queue<int, 16, std::less<int>, Arity> queue;
+	queue.heapify(values);
+
+	queue.push(11);
+	queue.emplace(10);
+
+	if (queue.push_pop(12) != 12 || queue.push_pop(-1) != 11)
+	{
+		return false;
+	}
+
+	queue.replace_top(-2);
+
+	std::vector<int> popped;
+	while (not queue.empty())
+	{
+		popped.push_back(queue.top());
+		queue.pop();
+	}
+
+	return popped == std::vector{ 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, -1, -2 }
+		&& std::ranges::equal(top_k<3>(values, std::greater<>{}), std::array{ 9, 8, 7 })
+		&& std::ranges::equal(top_k<4>(values), std::array{ 0, 1, 2, 3 });
+}
+
+bool test_24()
+{
+	static_arena_resource<4096> arena;
+	{
+		std::pmr::vector<int> vec{ &arena };
+		for (const int i : std::views::iota(0, 100))
+		{
+			vec.push_back(i);
+		}
+
+		if (arena.used() == 0 || arena.high_water_mark() < 100 * sizeof(int))
+		{
+			return false;
+		}
+	}
+
+	static_arena_resource<256, 16, true> recycling_arena;
+	void* const first = recycling_arena.allocate(24, 8);
+	recycling_arena.deallocate(first, 24, 8);
+
+	if (recycling_arena.allocate(32, 8) != first)
+	{
+		return false;
+	}
+
+	try
+	{
+		(void)recycling_arena.allocate(512);
+		return false;
+	}
+	catch (const std::bad_alloc&)
+	{
+	}
+
+	arena.release();
+
+	return arena.used() == 0 && arena.high_water_mark() >= 100 * sizeof(int);
+}
+
+constexpr bool test_25()
+{
+	using namespace std::literals;
+
+	static_object_pool<std::string, 100> pool;
+
+	std::string* const first = pool.create("first");
+	{
+		auto second = pool.make("second");
+		auto third = pool.make(3, 'x');
+
+		if (pool.size() != 3 || *second != "second" || third->size() != 3)
+		{
+			return false;
+		}
+	}
+
+	if (pool.size() != 1)
+	{
+		return false;
+	}
+
+	for (const auto index : std::views::iota(0, 70))
+	{
+		pool.create("string "s + (char)('0' + index % 10));
+	}
+
+	pool.destroy(first);
+
+	std::size_t visited = 0;
+	pool.for_each([&](const std::string& str) { visited += str.starts_with("string "); });
+
+	return visited == 70 && pool.size() == 70;
+}
+
+constexpr bool test_26()
+{
+	static_bitvector<200> flags;
+
+	for (const auto index : std::views::iota(0u, 150u))
+	{
+		flags.push_back(index % 3 == 0);
+	}
+
+	static_bitvector<200> others(150);
+	others.set(3);
+	others.set(66);
+	others.set(70);
+	others.set(147);
+
+	const auto both = flags & others;
+	const auto either = flags | others;
+
+	std::vector<std::size_t> set_bits;
+	for (const std::size_t index : both.set_bits())
+	{
+		set_bits.push_back(index);
+	}
+
+	if (set_bits != std::vector<std::size_t>{ 3, 66, 147 } || either.count() != 51
+		|| both.find_first() != 3 || both.find_next(3) != 66 || both.find_next(147) != both.npos)
+	{
+		return false;
+	}
+
+	flags.resize(10);
+	flags.resize(130, true);
+
+	return flags.count() == 124 && flags.find_next(9) == 10 && flags[129] && not flags[8];
+}
+
+constexpr bool test_27()
+{
+	static_jagged_vector<int, 32, 8> jagged;
+
+	jagged.push_row({ 1, 2, 3 });
+	jagged.push_row();
+	jagged.push_row(std::views::iota(10, 14));
+	jagged.append_to_last_row(14);
+	jagged.push_row({ 20 });
+
+	if (jagged.rows() != 4 || jagged.size() != 9 || jagged.row_size(1) != 0
+		|| not std::ranges::equal(jagged[2], std::array{ 10, 11, 12, 13, 14 }))
+	{
+		return false;
+	}
+
+	jagged.erase_row(0);
+
+	return jagged.rows() == 3 && jagged.size() == 6
+		&& std::ranges::equal(jagged.at(1), std::array{ 10, 11, 12, 13, 14 })
+		&& std::ranges::equal(jagged.back_row(), std::array{ 20 })
+		&& std::ranges::equal(jagged, std::array{ 10, 11, 12, 13, 14, 20 });
+}
+
+template<typename Layout>
+constexpr bool test_28()
+{
+	static_matrix<int, 4, 6, Layout> lhs;
+	static_matrix<int, 6, 2, Layout> rhs;
+
+	for (std::size_t row = 0; row != 4; ++row)
+	{
+		for (std::size_t col = 0; col != 6; ++col)
+		{
+			lhs(row, col) = static_cast<int>(row * 6 + col);
+			rhs(col, row % 2) = static_cast<int>(col + 1);
+		}
+	}
+
+	const auto product = multiply(lhs, rhs);
+	const auto view = product.mdspan();
+
+	return view[0, 0] == 70 && view[1, 1] == 196 && view[3, 0] == 448
+		&& transpose(transpose(lhs)) == lhs && transpose(lhs)(5, 3) == lhs(3, 5);
+}
+
+bool test_29()
+{
+	static_matrix<double, 96, 80> matrix;
+	static_matrix<double, 80, 80> identity;
+
+	for (std::size_t row = 0; row != 96; ++row)
+	{
+		for (std::size_t col = 0; col != 80; ++col)
+		{
+			matrix(row, col) = static_cast<double>(row * 80 + col);
+		}
+	}
+
+	for (std::size_t i = 0; i != 80; ++i)
+	{
+		identity(i, i) = 1.0;
+	}
+
+	static_vector<double, 16> storage{ 1, 2, 3, 4, 5, 6 };
+	const auto view = as_mdspan<std::extents<std::size_t, 2, 3>>(storage);
+
+	return multiply(matrix, identity) == matrix && transpose(transpose(matrix)) == matrix
+		&& view[1, 0] == 4.0;
+}
+
+bool test_30()
+{
+	static static_vector<int, 20000> vec;
+	vec.clear();
+	for (const int i : std::views::iota(0, 20000))
+	{
+		vec.push_back((i * 7919) % 20000);
+	}
+
+	const parallel::jthread_policy policy{ 4, 1024 };
+
+	parallel::transform(policy, vec, [](int i) { return i * 2; });
+	if (parallel::reduce(policy, vec, 0LL) != parallel::reduce(std::execution::par, vec, 0LL)
+		|| *parallel::find(policy, vec, 2 * 12345) != 2 * 12345)
+	{
+		return false;
+	}
+
+	parallel::sort(policy, vec);
+	if (not std::ranges::is_sorted(vec) || vec[0] != 0 || vec.back() != 39998)
+	{
+		return false;
+	}
+
+	const std::size_t removed = parallel::erase_if(policy, vec, [](int i) { return i % 3 == 0; });
+	const std::size_t removed_std = parallel::erase_if(std::execution::par_unseq, vec,
+		[](int i) { return i % 5 == 0; });
+
+	return removed == 6667 && removed_std == 2666 && std::ranges::is_sorted(vec)
+		&& std::ranges::none_of(vec, [](int i) { return i % 3 == 0 || i % 5 == 0; })
+		&& parallel::find(policy, vec, 3) == vec.end();
+}
+
+constexpr bool test_31()
+{
+	using namespace std::literals;
+
+	static_vector<std::string, 20> vec;
+
+	vec.append_generate(3, [](std::size_t i) { return "string "s + (char)('0' + i); });
+
+	int counter = 0;
+	vec.emplace_back_n(2, [&] { return std::string(++counter, 'x'); });
+
+	std::vector<std::string> source{ "moved 1"s, "moved 2"s };
+	vec.append_range(source);
+	vec.append_range(std::move(source));
+
+	return vec.size() == 9 && vec[2] == "string 2" && vec[4] == "xx"
+		&& vec[6] == "moved 2" && vec[8] == "moved 2"
+		&& std::ranges::all_of(source, std::ranges::empty);
+}
+
+constexpr bool test_32()
+{
+	using namespace std::literals;
+
+	std::vector<std::string> source{ "string 1"s, "string 2"s, "string 3"s };
+
+	static_vector<std::string, 10> constructed(std::from_range, std::move(source));
+	if (not std::ranges::all_of(source, std::ranges::empty) || constructed[2] != "string 3")
+	{
+		return false;
+	}
+
+	static_vector<std::string, 10> inserted{ "a"s, "b"s };
+	inserted.insert_range(inserted.begin() + 1, std::move(constructed));
+	if (not std::ranges::all_of(constructed, std::ranges::empty) || inserted[1] != "string 1")
+	{
+		return false;
+	}
+
+	static_vector<std::string, 10> moved(std::make_move_iterator(inserted.begin()),
+		std::make_move_iterator(inserted.end()));
+
+	static_vector<std::string, 10> assigned{ "x"s, "y"s, "z"s, "w"s, "v"s, "u"s };
+	assigned.assign_range(std::move(moved));
+
+	static_vector<int, 10> ints{ 9, 9, 9, 9, 9 };
+	ints.assign_range(std::vector{ 1, 2, 3 });
+	ints.insert_range(ints.begin() + 1, std::array{ 7, 8 });
+
+	return std::ranges::all_of(moved, std::ranges::empty) && assigned.size() == 5
+		&& assigned[4] == "b" && std::ranges::equal(ints, std::array{ 1, 7, 8, 2, 3 });
+}
+
+constexpr bool test_35()
+{
+	constexpr auto primes = shrink_to_exact<[]
+		{
+			static_vector<int, 1000> values;
+			for (int candidate = 2; candidate < 1000; ++candidate)
+			{
+				if (std::ranges::none_of(values, [=](int p) { return candidate % p == 0; }))
+				{
+					values.push_back(candidate);
+				}
+			}
+			return values;
+		}>();
+
+	constexpr auto squares = shrink_to_exact_array<[]
+		{
+			std::vector<long> values;
+			for (long i = 0; i != 300; ++i)
+			{
+				values.push_back(i * i);
+			}
+			return values;
+		}>();
+
+	static_assert(std::is_same_v<decltype(primes), const static_vector<int, 168>>);
+	static_assert(std::is_same_v<decltype(squares), const std::array<long, 300>>);
+	static_assert(sizeof(primes) == 168 * sizeof(int) + sizeof(int));
+
+	const static_vector<int, 3> converted = to_static_vector<3>(std::array{ 4, 5, 6 });
+
+	return primes.size() == 168 && primes[167] == 997 && squares[299] == 89401
+		&& converted.size() == 3 && converted[2] == 6;
+}
+
+constexpr bool test_36()
+{
+	static_vector<int, 10000> filled(10000, 7);
+	static_vector<int, 10000> zeroed(5000);
+	static_vector<int, 10000> copied = filled;
+
+	copied.resize(2500);
+	copied.insert(copied.begin(), zeroed.begin(), zeroed.end());
+	zeroed.assign_range(filled);
+	filled.clear();
+
+	static_vector<std::string, 1000> strings(1000, "value");
+	strings.erase(strings.begin(), strings.begin() + 500);
+
+	return copied.size() == 7500 && copied[4999] == 0 && copied[5000] == 7
+		&& zeroed.size() == 10000 && zeroed[9999] == 7 && filled.empty()
+		&& strings.size() == 500 && strings.back() == "value";
+}
+
+constexpr bool test_37()
+{
+	using namespace std::literals;
+
+	static_vector<int, 16> sorted{ 1, 4, 9 };
+	sorted.insert_sorted(5);
+	sorted.insert_sorted(0);
+	sorted.insert_sorted_range(std::array{ 8, 2, 10, 3 });
+	if (not std::ranges::equal(sorted, std::array{ 0, 1, 2, 3, 4, 5, 8, 9, 10 }))
+	{
+		return false;
+	}
+
+	static_vector<int, 8> tight{ 2, 4, 6, 8, 10 };
+	tight.merge_from(std::array{ 1, 5, 11 });
+	if (not std::ranges::equal(tight, std::array{ 1, 2, 4, 5, 6, 8, 10, 11 }))
+	{
+		return false;
+	}
+
+	static_vector<std::string, 8> words{ "cherry"s, "apple"s };
+	words.insert_sorted_range(std::vector{ "banana"s, "date"s }, std::ranges::greater{});
+	words.insert_sorted("blueberry"s, std::ranges::greater{});
+
+	static_vector<int, 8> descending{ 9, 6, 3 };
+	descending.merge_from(std::array{ 10, 6, 4, 0 }, std::ranges::greater{});
+
+	static_vector<int, 16> lhs{ 1, 2, 2, 3, 5, 8 };
+	lhs.set_union(std::array{ 2, 2, 2, 4, 8, 9 });
+
+	static_vector<int, 16> common{ 1, 2, 2, 3, 5, 8 };
+	common.set_intersection(std::array{ 2, 3, 4, 8 });
+
+	static_vector<int, 16> difference{ 1, 2, 2, 3, 5, 8 };
+	difference.set_difference(std::array{ 2, 5, 6 });
+
+	return std::ranges::equal(words, std::array{ "date"s, "cherry"s, "blueberry"s, "banana"s, "apple"s })
+		&& std::ranges::equal(descending, std::array{ 10, 9, 6, 6, 4, 3, 0 })
+		&& std::ranges::equal(lhs, std::array{ 1, 2, 2, 2, 3, 4, 5, 8, 9 })
+		&& std::ranges::equal(common, std::array{ 2, 3, 8 })
+		&& std::ranges::equal(difference, std::array{ 1, 2, 3, 8 });
+}
+
+template<std::size_t Count>
+constexpr bool test_38()
+{
+	static_vector<std::uint64_t, 256> levels;
+	for (std::uint64_t i = 0; i != Count; ++i)
+	{
+		levels.push_back(10 + 3 * (i / 2));
+	}
+
+	const static_eytzinger_index<std::uint64_t, 256> index{ levels };
+
+	for (std::uint64_t value = 0; value != 10 + 3 * Count; ++value)
+	{
+		const auto expected = std::ranges::lower_bound(levels, value);
+		if (branchless_lower_bound(levels, value) != expected
+			|| linear_lower_bound(levels, value) != expected
+			|| fast_lower_bound(levels, value) != expected
+			|| levels.begin() + index.lower_bound(value) != expected)
+		{
+			return false;
+		}
+	}
+
+	static_vector<int, 8> descending{ 9, 7, 7, 4, 1 };
+	*linear_lower_bound(descending, 4, std::ranges::greater{}) = 5;
+	*fast_lower_bound(descending, 1, std::ranges::greater{}) = 2;
+
+	return branchless_lower_bound(descending, 7, std::ranges::greater{}) == descending.begin() + 1
+		&& fast_lower_bound(descending, 0, std::ranges::greater{}) == descending.end()
+		&& std::ranges::equal(descending, std::array{ 9, 7, 7, 5, 2 });
+}
+
+bool test_39()
+{
+	struct level
+	{
+		std::uint64_t price;
+		std::uint32_t quantity;
+	};
+
+	seqlock_static_vector<level, 64> book{ static_vector<level, 64>(1, level{ 0, 0 }) };
+	std::atomic<bool> done{ false };
+	std::atomic<bool> torn{ false };
+
+	{
+		static_vector<std::jthread, 4> readers;
+		for (int i = 0; i != 4; ++i)
+		{
+			readers.emplace_back([&]
+				{
+					static_vector<level, 64> snapshot;
+					while (not done.load())
+					{
+						book.read_into(snapshot);
+						const std::uint64_t generation = snapshot[0].price;
+						const bool consistent = snapshot.size() == generation % 64 + 1
+							&& std::ranges::all_of(snapshot, [=](const level& l)
+								{
+									return l.price == generation && l.quantity == generation * 2;
+								});
+						if (not consistent)
+						{
+							torn.store(true);
+						}
+						std::this_thread::yield();
+					}
+				});
+		}
+
+		for (std::uint64_t generation = 1; generation != 5000; ++generation)
+		{
+			book.update([=](static_vector<level, 64>& levels)
+				{
+					levels.assign(generation % 64 + 1,
+						level{ generation, static_cast<std::uint32_t>(generation * 2) });
+				});
+		}
+		done.store(true);
+	}
+
+	return not torn.load() && book.version() == 5000 && book.snapshot().size() == 4999 % 64 + 1;
+}
+
+bool test_40()
+{
+	atomic_static_vector_publisher<int, 32> routes{ static_vector<int, 32>{ 0 } };
+
+	{
+		const auto pinned = routes.read();
+		routes.publish(static_vector<int, 32>{ 1, 1 });
+		const std::uint64_t third = routes.update([](static_vector<int, 32>& table) { table.push_back(2); });
+
+		if (pinned->size() != 1 || (*pinned)[0] != 0 || pinned.version() != 0 || third != 2
+			|| routes.read()->size() != 3)
+		{
+			return false;
+		}
+	}
+
+	routes.publish(static_vector<int, 32>(3, 2));
+
+	std::atomic<bool> done{ false };
+	std::atomic<bool> torn{ false };
+	{
+		static_vector<std::jthread, 4> readers;
+		for (int i = 0; i != 4; ++i)
+		{
+			readers.emplace_back([&]
+				{
+					while (not done.load())
+					{
+						const auto table = routes.read();
+						const int first = (*table)[0];
+						if (table->size() != static_cast<std::size_t>(first % 32 + 1)
+							|| not std::ranges::all_of(*table, [=](int value) { return value == first; }))
+						{
+							torn.store(true);
+						}
+						std::this_thread::yield();
+					}
+				});
+		}
+
+		for (int generation = 3; generation != 3000; ++generation)
+		{
+			routes.update([=](static_vector<int, 32>& table)
+				{
+					table.assign(static_cast<std::size_t>(generation % 32 + 1), generation);
+				});
+		}
+		done.store(true);
+	}
+
+	return not torn.load() && routes.version() == 3000;
+}
+
+constexpr bool test_41()
+{
+	const std::array values{ 1, 2, 3, 4, 5, 6, 7 };
+
+	static_vector<int, 8> sizes;
+	static_vector<int, 8> sums;
+	for (static_vector<int, 3>& batch : chunked_into<3>(values))
+	{
+		sizes.push_back(static_cast<int>(batch.size()));
+		sums.push_back(std::accumulate(batch.begin(), batch.end(), 0));
+	}
+
+	static_vector<std::string, 8> moved;
+	for (auto& batch : chunked_into<2>(std::views::iota(0, 20)
+		| std::views::filter([](int i) { return i % 3 == 0; })
+		| std::views::transform([](int i) { return std::string(static_cast<std::size_t>(i), 'x'); })))
+	{
+		moved.push_back(std::move(batch.back()));
+	}
+
+	return std::ranges::equal(sizes, std::array{ 3, 3, 1 }) && std::ranges::equal(sums, std::array{ 6, 15, 7 })
+		&& moved.size() == 4 && moved[0].size() == 3 && moved[3].size() == 18
+		&& [] { auto none = chunked_into<4>(std::views::empty<int>); return none.begin() == none.end(); }();
+}
+
+bool test_42()
+{
+	batch_channel<int, 16, 2> channel;
+
+	std::jthread producer([&]
+		{
+			for (auto& batch : chunked_into<16>(std::views::iota(0, 1000)))
+			{
+				channel.push(std::move(batch));
+			}
+			channel.close();
+		});
+
+	long long total = 0;
+	std::size_t batches = 0;
+	while (std::optional<static_vector<int, 16>> batch = channel.pop())
+	{
+		total = std::accumulate(batch->begin(), batch->end(), total);
+		++batches;
+	}
+
+	static_vector<int, 16> spare{ 1 };
+	return total == 999 * 1000 / 2 && batches == 63 && channel.closed()
+		&& not channel.try_push(spare) && not channel.try_pop();
+}
+
+constexpr bool test_43()
+{
+	std::vector<int> source(50);
+	std::iota(source.begin(), source.end(), 0);
+
+	int checksum = 0;
+	std::size_t last_size = 0;
+	for (const static_vector<int, 16>& block : source
+		| std::views::transform([](int i) { return i * 2; })
+		| views::chunk_static<16>)
+	{
+		checksum += std::accumulate(block.begin(), block.end(), 0);
+		last_size = block.size();
+	}
+
+	std::size_t blocks = 0;
+	for (const auto& block : views::chunk_static<10>(source))
+	{
+		blocks += block.size() == 10;
+	}
+
+	return checksum == 49 * 50 && last_size == 2 && blocks == 5;
+}
+
+bool test_44()
+{
+	std::deque<double> samples(1000, 0.5);
+	double total = 0;
+	for (const static_vector<double, 64>& block : samples | views::chunk_static<64>)
+	{
+		total += std::accumulate(block.begin(), block.end(), 0.0);
+	}
+
+	std::istringstream stream{ "1 2 3 4 5 6 7" };
+	static_vector<std::size_t, 4> sizes;
+	for (const auto& block : std::views::istream<int>(stream) | views::chunk_static<3>)
+	{
+		sizes.push_back(block.size());
+	}
+
+	return total == 500.0 && std::ranges::equal(sizes, std::array<std::size_t, 3>{ 3, 3, 1 });
+}
+
+constexpr bool test_45()
+{
+	using namespace std::literals;
+
+	static_vector<std::string, 8> vec{ "first string"s, "second string"s, "third string"s };
+	vec.erase(vec.begin() + 1, vec.begin() + 1);
+	vec.insert(vec.begin(), 0, "unused"s);
+	vec.insert_range(vec.begin() + 1, std::vector<std::string>{});
+
+	return std::ranges::equal(vec, std::array{ "first string"s, "second string"s, "third string"s });
+}
+
+constexpr bool test_47()
+{
+	using namespace std::literals;
+
+	static_vector<int, 8> ints{ 1, 2, 3 };
+	ints.insert(ints.begin(), ints[2]);
+	ints.emplace(ints.begin() + 1, ints.back());
+	ints.insert(ints.begin(), 2, ints[3]);
+
+	static_vector<std::string, 8> strings{ "a long string to defeat sso"s, "b"s, "c"s };
+	strings.insert(strings.begin(), strings[0]);
+	strings.emplace(strings.begin() + 2, strings.back());
+	strings.insert(strings.begin() + 1, 2, strings[4]);
+
+	return std::ranges::equal(ints, std::array{ 2, 2, 3, 3, 1, 2, 3 })
+		&& std::ranges::equal(strings, std::array{ "a long string to defeat sso"s, "c"s, "c"s,
+			"a long string to defeat sso"s, "c"s, "b"s, "c"s });
+}
+
+bool test_48()
+{
+	static_arena_resource<256, 16, true> arena;
+
+	void* const header = arena.allocate(64, 16);
+	void* const body = arena.allocate(160, 16);
+	const std::size_t used = arena.used();
+	arena.deallocate(body, 160, 16);
+
+	void* const retry = arena.allocate(129, 16);
+	arena.deallocate(retry, 129, 16);
+	arena.deallocate(header, 64, 16);
+
+	return used == 224 && retry == body && arena.used() == 64 && arena.allocate(33, 16) == header;
+}
+
+bool test_49()
+{
+	static_jagged_vector<int, 8, 4> jagged;
+
+	bool threw = false;
+	try
+	{
+		jagged.append_to_last_row(1);
+	}
+	catch (const std::out_of_range&)
+	{
+		threw = true;
+	}
+
+	jagged.push_row({ 2, 3 });
+	jagged.append_to_last_row(4);
+
+	return threw && jagged.rows() == 1 && jagged.size() == 3
+		&& std::ranges::equal(jagged.at(0), std::array{ 2, 3, 4 });
+}
+
+constexpr bool test_50()
+{
+	constexpr auto none = shrink_to_exact<[] { return static_vector<int, 16>{}; }>();
+	constexpr auto no_array = shrink_to_exact_array<[] { return std::vector<long>{}; }>();
+
+	static_assert(std::is_same_v<decltype(none), const static_vector<int, 0>>);
+	static_assert(std::is_same_v<decltype(no_array), const std::array<long, 0>>);
+
+	static_vector<int, 0> copy = none;
+	copy.clear();
+
+	return none.empty() && none.capacity() == 0 && none.begin() == none.end() && copy.empty();
+}
+
+bool test_51()
+{
+	static_vector<int, 4> merged{ 1, 5 };
+	std::istringstream stream{ "2 3 4" };
+
+	bool merge_threw = false;
+	try
+	{
+		merged.merge_from(std::views::istream<int>(stream));
+	}
+	catch (const std::length_error&)
+	{
+		merge_threw = true;
+	}
+
+	static_vector<int, 4> inserted{ 1, 5 };
+	bool insert_threw = false;
+	try
+	{
+		inserted.insert_sorted_range(std::array{ 4, 3, 2 });
+	}
+	catch (const std::length_error&)
+	{
+		insert_threw = true;
+	}
+
+	return merge_threw && insert_threw
+		&& std::ranges::equal(merged, std::array{ 1, 5 }) && std::ranges::equal(inserted, std::array{ 1, 5 });
+}
+
+struct detached_task
+{
+	struct promise_type
+	{
+		detached_task get_return_object() noexcept { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() noexcept {}
+		void unhandled_exception() noexcept { std::terminate(); }
+	};
+};
+
+detached_task consume_batches(batch_channel<int, 8, 1>& channel, long long& total, std::size_t& batches)
+{
+	while (std::optional<static_vector<int, 8>> batch = co_await channel.async_pop())
+	{
+		total = std::accumulate(batch->begin(), batch->end(), total);
+		++batches;
+	}
+}
+
+detached_task produce_batches(batch_channel<int, 8, 1>& channel, bool& rejected)
+{
+	for (auto& batch : chunked_into<8>(std::views::iota(0, 100)))
+	{
+		co_await channel.async_push(std::move(batch));
+	}
+	channel.close();
+
+	static_vector<int, 8> late{ 1 };
+	rejected = not co_await channel.async_push(std::move(late));
+}
+
+detached_task forward_batch(batch_channel<int, 8, 1>& in, batch_channel<int, 8, 1>& out)
+{
+	std::optional<static_vector<int, 8>> batch = co_await in.async_pop();
+	(*batch)[0] += 1;
+	co_await out.async_push(std::move(*batch));
+}
+
+bool test_52()
+{
+	batch_channel<int, 8, 1> channel;
+
+	long long total = 0;
+	std::size_t batches = 0;
+	bool rejected = false;
+	consume_batches(channel, total, batches);
+	produce_batches(channel, rejected);
+
+	batch_channel<int, 8, 1> queued;
+	bool late_rejected = false;
+	queued.push(static_vector<int, 8>{ 5 });
+	produce_batches(queued, late_rejected);
+	const std::optional<static_vector<int, 8>> first = queued.pop();
+
+	long long drained = 0;
+	std::size_t drained_batches = 0;
+	consume_batches(queued, drained, drained_batches);
+
+	std::deque<batch_channel<int, 8, 1>> stages(50001);
+	for (std::size_t stage = 0; stage + 1 != stages.size(); ++stage)
+	{
+		forward_batch(stages[stage], stages[stage + 1]);
+	}
+	stages.front().push(static_vector<int, 8>{ 0 });
+	const std::optional<static_vector<int, 8>> forwarded = stages.back().try_pop();
+
+	return total == 99 * 100 / 2 && batches == 13 && rejected && forwarded && (*forwarded)[0] == 50000
+		&& first && (*first)[0] == 5 && drained == 99 * 100 / 2 && drained_batches == 13 && late_rejected;
+}
+
+constexpr bool test_53()
+{
+	static_vector<int, 4> vec{ 1, 2, 3 };
+	const static_vector<int, 4>& view = vec;
+
+	vec.front() = 0;
+
+	return view.front() == 0 && *vec.rbegin() == 3 && *view.rbegin() == 3 && *view.crbegin() == 3
+		&& std::ranges::equal(std::ranges::subrange(vec.rbegin(), vec.rend()), std::array{ 3, 2, 0 })
+		&& std::ranges::equal(std::ranges::subrange(view.crbegin(), view.crend()), std::array{ 3, 2, 0 });
+}
+
+struct move_counter
+{
+	int value;
+	int* moves;
+
+	constexpr move_counter(int value, int* moves) noexcept : value{ value }, moves{ moves } {}
+	constexpr move_counter(move_counter&& other) noexcept : value{ other.value }, moves{ other.moves } { ++*moves; }
+
+	constexpr move_counter& operator=(move_counter&& other) noexcept
+	{
+		value = other.value;
+		moves = other.moves;
+		++*moves;
+		return *this;
+	}
+};
+
+constexpr bool test_54()
+{
+	int moves = 0;
+	static_vector<move_counter, 4> vec;
+	vec.emplace_back(1, &moves);
+	vec.emplace_back(2, &moves);
+	vec.emplace_back(3, &moves);
+
+	vec.emplace(vec.begin() + 1, 9, &moves);
+
+	return moves == 2 && std::ranges::equal(vec | std::views::transform(&move_counter::value), std::array{ 1, 9, 2, 3 });
+}
+
+bool test_55()
+{
+	static_object_pool<std::string, 0> pool;
+
+	bool threw = false;
+	try
+	{
+		pool.create("unused");
+	}
+	catch (const std::length_error&)
+	{
+		threw = true;
+	}
+
+	std::size_t visited = 0;
+	pool.for_each([&](const std::string&) { ++visited; });
+
+	return threw && visited == 0 && pool.empty() && pool.capacity() == 0;
+}
+
+bool test_56()
+{
+	static_vector<std::string, 256> vec;
+	for (const int i : std::views::iota(0, 256))
+	{
+		vec.push_back("a string long enough to live on the heap " + std::to_string(1000 + i));
+	}
+
+	const auto pred = [](const std::string& str) { return str[str.size() - 3] != '0' && str.back() % 2 == 1; };
+	std::vector<std::string> expected(vec.begin(), vec.end());
+	std::erase_if(expected, pred);
+
+	const std::size_t removed = parallel::erase_if(parallel::jthread_policy{ 4, 16 * sizeof(std::string) }, vec, pred);
+
+	return removed == 78 && std::ranges::equal(vec, expected);
+}
+
+bool test_46()
+{
+	const static_vector<int, 8> levels{ 1, 2, 255 };
+	const static_vector<int, 8> empty;
+
+	std::array<char, 32> buffer{};
+	const std::to_chars_result written = to_chars(buffer.data(), buffer.data() + buffer.size(), levels);
+	const std::string_view encoded{ buffer.data(), written.ptr };
+
+	static_vector<int, 8> decoded;
+	const std::from_chars_result parsed = from_chars(encoded.data(), encoded.data() + encoded.size(), decoded);
+
+	static_vector<int, 2> small;
+	const std::from_chars_result overflow = from_chars(encoded.data(), encoded.data() + encoded.size(), small);
+
+	std::array<char, 4> tiny{};
+	const std::to_chars_result truncated = to_chars(tiny.data(), tiny.data() + tiny.size(), levels, ';');
+
+	static_vector<double, 4> prices;
+	const std::string_view text = "1.5|2.25|x";
+	const std::from_chars_result partial = from_chars(text.data(), text.data() + text.size(), prices, '|');
+
+	static_vector<int, 8> trailing;
+	const std::string_view dangling = "1,2,";
+	const std::from_chars_result unfinished = from_chars(dangling.data(), dangling.data() + dangling.size(), trailing);
+
+	return std::format("{}", levels) == "[1, 2, 255]" && std::format("{:n}", levels) == "1, 2, 255"
+		&& std::format("{::x}", levels) == "[1, 2, ff]" && std::format("{}", empty) == "[]"
+		&& std::format("{:*^15}", levels) == "**[1, 2, 255]**" && std::format("{:>10n:x}", levels) == "  1, 2, ff"
+		&& written.ec == std::errc{} && encoded == "1,2,255"
+		&& parsed.ec == std::errc{} && parsed.ptr == encoded.data() + encoded.size() && decoded == levels
+		&& overflow.ec == std::errc::value_too_large && small.size() == 2
+		&& truncated.ec == std::errc::value_too_large
+		&& partial.ec == std::errc::invalid_argument && prices.size() == 2 && prices[1] == 2.25
+		&& unfinished.ec == std::errc::invalid_argument && unfinished.ptr == dangling.data() + dangling.size()
+		&& std::ranges::equal(trailing, std::array{ 1, 2 });
+}
+
+#if __has_include(<sys/uio.h>)
+bool test_33()
+{
+	int fds[2];
+	if (::pipe(fds) != 0)
+	{
+		return false;
+	}
+
+	const std::array header{ std::byte{ 1 }, std::byte{ 2 } };
+	const std::array payload{ std::byte{ 3 }, std::byte{ 4 }, std::byte{ 5 } };
+
+	static_vector<std::span<const std::byte>, 4> spans{ header, payload };
+	const std::size_t written = write_gather(fds[1], spans);
+
+	static_vector<std::byte, 16> out{ std::byte{ 0 } };
+	const std::size_t sent = write_some(fds[1], out);
+
+	static_vector<std::byte, 16> in;
+	const std::size_t first = read_append(fds[0], in, 3);
+	const std::size_t second = read_append(fds[0], in);
+
+	::close(fds[0]);
+	::close(fds[1]);
+
+	return written == 5 && sent == 1 && first == 3 && second == 3 && in.size() == 6
+		&& in[2] == std::byte{ 3 } && in[5] == std::byte{ 0 }
+		&& spare_iovec(in).iov_len == 10 && filled_iovec(in).iov_len == 6;
+}
+
+bool test_34()
+{
+	static_buffer_ring<8, 3> ring;
+
+	const auto a = ring.acquire();
+	const auto b = ring.acquire();
+	const auto c = ring.acquire();
+	const bool exhausted = not ring.acquire().has_value();
+
+	ring[*a].append_range(std::array{ std::byte{ 7 }, std::byte{ 8 }, std::byte{ 9 } });
+	ring.release(*b);
+	const auto reused = ring.acquire();
+
+	std::FILE* file = std::tmpfile();
+	if (file == nullptr)
+	{
+		return false;
+	}
+
+	const std::size_t written = pwrite_from(ring, *a, ::fileno(file), 2);
+	const std::size_t read = pread_into(ring, *reused, ::fileno(file), 0);
+	std::fclose(file);
+
+	bool threw = false;
+	try
+	{
+		ring.complete(*c, 9);
+	}
+	catch (const std::length_error&)
+	{
+		threw = true;
+	}
+
+	ring.release(*a);
+
+	return exhausted && reused == b && written == 3 && read == 5 && ring[*reused].size() == 5
+		&& ring[*reused][2] == std::byte{ 7 } && ring[*reused][4] == std::byte{ 9 } && ring[*a].empty()
+		&& threw && ring.iovecs()[*c].iov_base == ring[*c].data() && ring.iovecs()[*c].iov_len == 8;
+}
+#endif
+
 template<typename Vec>
 constexpr void contiguous_range_test()
 {
@@ -394,14 +1531,41 @@ int main()
 		static_assert(test_6() == true);
 		static_assert(test_7() == true);
 		static_assert(test_8() == true);
-		// static_assert(test_9() == true); 
-		// static_assert(test_10() == true); 
+		static_assert(test_9() == true);
+		static_assert(test_10() == true);
 		static_assert(test_11() == true);
 		static_assert(test_12() == true);
 		static_assert(test_13() == true);
 		static_assert(test_14() == true);
 		static_assert(test_15() == true);
 		static_assert(test_16() == true);
+		static_assert(test_17() == true);
+		static_assert(test_18() == true);
+		static_assert(test_20() == true);
+		static_assert(test_22() == true);
+		static_assert(test_23<2>() == true);
+		static_assert(test_23<4>() == true);
+		static_assert(test_25() == true);
+		static_assert(test_26() == true);
+		static_assert(test_27() == true);
+		static_assert(test_28<std::layout_right>() == true);
+		static_assert(test_28<std::layout_left>() == true);
+		static_assert(test_28<layout_blocked<2, 2>>() == true);
+		static_assert(test_31() == true);
+		static_assert(test_32() == true);
+		static_assert(test_35() == true);
+		static_assert(test_36() == true);
+		static_assert(test_37() == true);
+		static_assert(test_41() == true);
+		static_assert(test_43() == true);
+		static_assert(test_45() == true);
+		static_assert(test_47() == true);
+		static_assert(test_50() == true);
+		static_assert(test_53() == true);
+		static_assert(test_54() == true);
+		static_assert(test_38<0>() == true);
+		static_assert(test_38<1>() == true);
+		static_assert(test_38<37>() == true);
 	}
 	{
 		assert(test_1<2>() == '3');
@@ -420,5 +1584,53 @@ int main()
 		assert(test_14() == true);
 		assert(test_15() == true);
 		assert(test_16() == true);
+		assert(test_17() == true);
+		assert(test_18() == true);
+		assert(test_19() == true);
+		assert(test_20() == true);
+		assert(test_21() == true);
+		assert(test_22() == true);
+		assert(test_23<2>() == true);
+		assert(test_23<4>() == true);
+		assert(test_24() == true);
+		assert(test_25() == true);
+		assert(test_26() == true);
+		assert(test_27() == true);
+		assert(test_28<std::layout_right>() == true);
+		assert(test_28<std::layout_left>() == true);
+		assert((test_28<layout_blocked<2, 2>>() == true));
+		assert(test_29() == true);
+		assert(test_30() == true);
+		assert(test_31() == true);
+		assert(test_32() == true);
+		assert(test_35() == true);
+		assert(test_36() == true);
+		assert(test_37() == true);
+		assert(test_38<0>() == true);
+		assert(test_38<1>() == true);
+		assert(test_38<37>() == true);
+		assert(test_38<256>() == true);
+		assert(test_39() == true);
+		assert(test_40() == true);
+		assert(test_41() == true);
+		assert(test_42() == true);
+		assert(test_43() == true);
+		assert(test_44() == true);
+		assert(test_45() == true);
+		assert(test_46() == true);
+		assert(test_47() == true);
+		assert(test_48() == true);
+		assert(test_49() == true);
+		assert(test_50() == true);
+		assert(test_51() == true);
+		assert(test_52() == true);
+		assert(test_53() == true);
+		assert(test_54() == true);
+		assert(test_55() == true);
+		assert(test_56() == true);
+#if __has_include(<sys/uio.h>)
+		assert(test_33() == true);
+		assert(test_34() == true);
+#endif
 	}
 }
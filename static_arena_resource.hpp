@@ -0,0 +1,151 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <string>
+
+template<std::size_t Bytes, std::size_t Align = alignof(std::max_align_t), bool RecycleBlocks = false>
+class static_arena_resource final : public std::pmr::memory_resource
+{
+	static_assert(std::has_single_bit(Align), "Arena alignment must be a power of two");
+
+public:
+	static_arena_resource() noexcept = default;
+
+	static_arena_resource(const static_arena_resource&) = delete;
+	static_arena_resource& operator=(const static_arena_resource&) = delete;
+
+	void release() noexcept
+	{
+		used_ = 0;
+		if constexpr (RecycleBlocks)
+		{
+			free_lists_.fill(nullptr);
+		}
+	}
+
+	std::size_t capacity() const noexcept
+	{
+		return Bytes;
+	}
+
+	std::size_t used() const noexcept
+	{
+		return used_;
+	}
+
+	std::size_t remaining() const noexcept
+	{
+		return Bytes - used_;
+	}
+
+	std::size_t high_water_mark() const noexcept
+	{
+		return high_water_;
+	}
+
+	std::string usage_report() const
+	{
+		return std::format("static_arena_resource: {} of {} bytes in use, "
+			"high-water mark of {} bytes", used_, Bytes, high_water_);
+	}
+
+private:
+	struct free_block
+	{
+		free_block* next;
+	};
+
+	static constexpr std::size_t size_class_count = std::bit_width(Bytes) + 1;
+
+	static constexpr std::size_t size_class_bytes(std::size_t bytes) noexcept
+	{
+		return std::bit_ceil(std::max(bytes, sizeof(free_block)));
+	}
+
+	bool holds_size_class(const void* ptr, std::size_t block) const noexcept
+	{
+		return block <= Bytes - static_cast<std::size_t>(static_cast<const std::byte*>(ptr) - buffer_);
+	}
+
+	void* do_allocate(std::size_t bytes, std::size_t alignment) override
+	{
+		if (bytes > Bytes) [[unlikely]]
+		{
+			throw std::bad_alloc{};
+		}
+
+		if constexpr (RecycleBlocks)
+		{
+			alignment = std::max(alignment, alignof(free_block));
+
+			free_block*& head = free_lists_[std::bit_width(size_class_bytes(bytes)) - 1];
+			if (head != nullptr && reinterpret_cast<std::uintptr_t>(head) % alignment == 0)
+			{
+				free_block* const block = head;
+				head = block->next;
+				return block;
+			}
+		}
+
+		void* ptr = buffer_ + used_;
+		std::size_t space = Bytes - used_;
+
+		if (std::align(alignment, bytes, ptr, space) == nullptr) [[unlikely]]
+		{
+			throw std::bad_alloc{};
+		}
+
+		if constexpr (RecycleBlocks)
+		{
+			if (holds_size_class(ptr, size_class_bytes(bytes)))
+			{
+				bytes = size_class_bytes(bytes);
+			}
+		}
+
+		used_ = static_cast<std::size_t>(static_cast<std::byte*>(ptr) - buffer_) + bytes;
+		high_water_ = std::max(high_water_, used_);
+
+		return ptr;
+	}
+
+	void do_deallocate(void* ptr, std::size_t bytes, std::size_t) override
+	{
+		if constexpr (RecycleBlocks)
+		{
+			if (const std::size_t block = size_class_bytes(bytes); holds_size_class(ptr, block))
+			{
+				free_block*& head = free_lists_[std::bit_width(block) - 1];
+				head = ::new (ptr) free_block{ head };
+				return;
+			}
+		}
+
+		if (static_cast<std::byte*>(ptr) + bytes == buffer_ + used_)
+		{
+			used_ -= bytes;
+		}
+	}
+
+	bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+	{
+		return this == &other;
+	}
+
+	union {
+		std::byte dummy_{};
+		alignas(Align) std::byte buffer_[Bytes];
+	};
+	std::size_t used_ = 0;
+	std::size_t high_water_ = 0;
+	[[no_unique_address]] std::conditional_t<RecycleBlocks,
+		std::array<free_block*, size_class_count>, std::array<free_block*, 0>> free_lists_{};
+};
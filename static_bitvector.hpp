@@ -0,0 +1,324 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <format>
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+
+#include "static_vector.hpp"
+
+template<std::size_t Capacity>
+class static_bitvector
+{
+private:
+	using real_size_t = detail::smallest_size_type_t<Capacity>;
+	using word_t = std::uint64_t;
+
+	static constexpr std::size_t word_bits = 64;
+	static constexpr std::size_t word_count = (Capacity + word_bits - 1) / word_bits;
+
+public:
+	using value_type = bool;
+	using size_type = std::size_t;
+
+	static constexpr size_type npos = static_cast<size_type>(-1);
+
+	class set_bit_iterator
+	{
+	public:
+		using value_type = size_type;
+		using difference_type = std::ptrdiff_t;
+
+		constexpr set_bit_iterator() noexcept = default;
+
+		constexpr size_type operator*() const noexcept
+		{
+			return word_ * word_bits + static_cast<size_type>(std::countr_zero(bits_));
+		}
+
+		constexpr set_bit_iterator& operator++() noexcept
+		{
+			bits_ &= bits_ - 1;
+			skip_empty_words();
+			return *this;
+		}
+
+		constexpr void operator++(int) noexcept
+		{
+			++*this;
+		}
+
+		friend constexpr bool operator==(const set_bit_iterator& it, std::default_sentinel_t) noexcept
+		{
+			return it.bits_ == 0;
+		}
+
+	private:
+		friend static_bitvector;
+
+		constexpr explicit set_bit_iterator(const word_t* words) noexcept
+			: words_{ words }
+			, bits_{ word_count != 0 ? words[0] : 0 }
+		{
+			skip_empty_words();
+		}
+
+		constexpr void skip_empty_words() noexcept
+		{
+			while (bits_ == 0 && word_ + 1 < word_count)
+			{
+				bits_ = words_[++word_];
+			}
+		}
+
+		const word_t* words_ = nullptr;
+		size_type word_ = 0;
+		word_t bits_ = 0;
+	};
+
+	constexpr static_bitvector() noexcept = default;
+
+	constexpr explicit static_bitvector(size_type count, bool value = false)
+	{
+		resize(count, value);
+	}
+
+	constexpr bool operator[](size_type pos) const noexcept
+	{
+		return (words_[pos / word_bits] >> (pos % word_bits)) & 1;
+	}
+
+	constexpr bool test(size_type pos) const
+	{
+		if (pos >= size()) [[unlikely]]
+		{
+			throw std::out_of_range{ std::format("Index {} is out of "
+				"the range of the bitvector. Range is [0, {})!",
+				pos, size()) };
+		}
+
+		return (*this)[pos];
+	}
+
+	constexpr void set(size_type pos, bool value = true) noexcept
+	{
+		const word_t mask = word_t{ 1 } << (pos % word_bits);
+		words_[pos / word_bits] = value ? words_[pos / word_bits] | mask
+			: words_[pos / word_bits] & ~mask;
+	}
+
+	constexpr void reset(size_type pos) noexcept
+	{
+		set(pos, false);
+	}
+
+	constexpr void flip(size_type pos) noexcept
+	{
+		words_[pos / word_bits] ^= word_t{ 1 } << (pos % word_bits);
+	}
+
+	constexpr void push_back(bool value)
+	{
+		if (size() == capacity()) [[unlikely]]
+		{
+			throw std::length_error{ std::format("Static bitvector push_back call would "
+				"exceed the bitvector's capacity of {}", capacity()) };
+		}
+
+		set(size(), value);
+		++size_;
+	}
+
+	constexpr void pop_back() noexcept
+	{
+		--size_;
+		reset(size());
+	}
+
+	constexpr void resize(size_type count, bool value = false)
+	{
+		if (count > capacity()) [[unlikely]]
+		{
+			throw std::length_error{ std::format("resize request for {} bits "
+				"on static_bitvector of max capacity of {} cannot be fulfilled.",
+				count, capacity()) };
+		}
+
+		if (count < size())
+		{
+			fill_range(count, size(), false);
+		}
+		else if (value)
+		{
+			fill_range(size(), count, true);
+		}
+
+		size_ = static_cast<real_size_t>(count);
+	}
+
+	constexpr void clear() noexcept
+	{
+		words_.fill(0);
+		size_ = 0;
+	}
+
+	constexpr size_type count() const noexcept
+	{
+		size_type result = 0;
+		for (const word_t word : words_)
+		{
+			result += static_cast<size_type>(std::popcount(word));
+		}
+		return result;
+	}
+
+	constexpr bool any() const noexcept
+	{
+		return find_first() != npos;
+	}
+
+	constexpr bool none() const noexcept
+	{
+		return not any();
+	}
+
+	constexpr bool all() const noexcept
+	{
+		return count() == size();
+	}
+
+	constexpr size_type find_first() const noexcept
+	{
+		return find_from(0);
+	}
+
+	constexpr size_type find_next(size_type pos) const noexcept
+	{
+		return pos + 1 < size() ? find_from(pos + 1) : npos;
+	}
+
+	constexpr auto set_bits() const noexcept
+	{
+		return std::ranges::subrange(set_bit_iterator{ words_.data() }, std::default_sentinel);
+	}
+
+	constexpr static_bitvector& operator&=(const static_bitvector& other) noexcept
+	{
+		for (size_type i = 0; i != word_count; ++i)
+		{
+			words_[i] &= other.words_[i];
+		}
+		return *this;
+	}
+
+	constexpr static_bitvector& operator|=(const static_bitvector& other) noexcept
+	{
+		for (size_type i = 0; i != word_count; ++i)
+		{
+			words_[i] |= other.words_[i];
+		}
+		trim();
+		return *this;
+	}
+
+	constexpr static_bitvector& operator^=(const static_bitvector& other) noexcept
+	{
+		for (size_type i = 0; i != word_count; ++i)
+		{
+			words_[i] ^= other.words_[i];
+		}
+		trim();
+		return *this;
+	}
+
+	friend constexpr static_bitvector operator&(static_bitvector lhs, const static_bitvector& rhs) noexcept
+	{
+		return lhs &= rhs;
+	}
+
+	friend constexpr static_bitvector operator|(static_bitvector lhs, const static_bitvector& rhs) noexcept
+	{
+		return lhs |= rhs;
+	}
+
+	friend constexpr static_bitvector operator^(static_bitvector lhs, const static_bitvector& rhs) noexcept
+	{
+		return lhs ^= rhs;
+	}
+
+	friend constexpr bool operator==(const static_bitvector&, const static_bitvector&) noexcept = default;
+
+	constexpr size_type size() const noexcept
+	{
+		return static_cast<size_type>(size_);
+	}
+
+	constexpr size_type capacity() const noexcept
+	{
+		return Capacity;
+	}
+
+	constexpr size_type max_size() const noexcept
+	{
+		return capacity();
+	}
+
+	constexpr bool empty() const noexcept
+	{
+		return size_ == 0;
+	}
+
+	constexpr const word_t* words() const noexcept
+	{
+		return words_.data();
+	}
+
+private:
+	constexpr size_type find_from(size_type pos) const noexcept
+	{
+		size_type word = pos / word_bits;
+		if (word >= word_count)
+		{
+			return npos;
+		}
+
+		word_t bits = words_[word] & (~word_t{ 0 } << (pos % word_bits));
+		while (bits == 0)
+		{
+			if (++word == word_count)
+			{
+				return npos;
+			}
+			bits = words_[word];
+		}
+
+		return word * word_bits + static_cast<size_type>(std::countr_zero(bits));
+	}
+
+	constexpr void fill_range(size_type first, size_type last, bool value) noexcept
+	{
+		while (first != last)
+		{
+			const size_type offset = first % word_bits;
+			const size_type bits = std::min(word_bits - offset, last - first);
+			const word_t mask = (bits == word_bits ? ~word_t{ 0 } : ((word_t{ 1 } << bits) - 1)) << offset;
+
+			word_t& word = words_[first / word_bits];
+			word = value ? word | mask : word & ~mask;
+
+			first += bits;
+		}
+	}
+
+	constexpr void trim() noexcept
+	{
+		fill_range(size(), word_count * word_bits, false);
+	}
+
+	std::array<word_t, word_count> words_{};
+	real_size_t size_ = 0;
+};
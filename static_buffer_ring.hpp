@@ -0,0 +1,213 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <format>
+#include <optional>
+#include <span>
+#include <stdexcept>
+#include <system_error>
+
+#include "static_vector.hpp"
+#include "static_vector_io.hpp"
+
+#if __has_include(<sys/uio.h>)
+
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if __has_include(<liburing.h>)
+#include <liburing.h>
+#endif
+
+template<std::size_t BufSize, std::size_t Count>
+class static_buffer_ring
+{
+	static_assert(Count < (std::uint64_t{ 1 } << 32), "Slot indices are packed into 32 bits");
+
+public:
+	using buffer_type = static_vector<std::byte, BufSize>;
+	using index_type = detail::smallest_size_type_t<Count>;
+	using size_type = std::size_t;
+
+	static constexpr index_type npos = static_cast<index_type>(Count);
+
+	static_buffer_ring() noexcept
+	{
+		for (size_type i = 0; i != Count; ++i)
+		{
+			iovecs_[i] = iovec{ buffers_[i].data(), BufSize };
+			next_[i].store(static_cast<index_type>(i + 1), std::memory_order_relaxed);
+		}
+		head_.store(pack(Count != 0 ? 0 : npos, 0), std::memory_order_relaxed);
+	}
+
+	static_buffer_ring(const static_buffer_ring&) = delete;
+	static_buffer_ring& operator=(const static_buffer_ring&) = delete;
+
+	std::optional<index_type> acquire() noexcept
+	{
+		std::uint64_t head = head_.load(std::memory_order_acquire);
+		while (true)
+		{
+			const index_type slot = index_of(head);
+			if (slot == npos)
+			{
+				return std::nullopt;
+			}
+
+			const index_type next = next_[slot].load(std::memory_order_relaxed);
+			if (head_.compare_exchange_weak(head, pack(next, tag_of(head) + 1),
+				std::memory_order_acq_rel, std::memory_order_acquire))
+			{
+				return slot;
+			}
+		}
+	}
+
+	void release(index_type slot) noexcept
+	{
+		buffers_[slot].clear();
+
+		std::uint64_t head = head_.load(std::memory_order_relaxed);
+		do
+		{
+			next_[slot].store(index_of(head), std::memory_order_relaxed);
+		} while (not head_.compare_exchange_weak(head, pack(slot, tag_of(head) + 1),
+			std::memory_order_release, std::memory_order_relaxed));
+	}
+
+	void complete(index_type slot, size_type bytes)
+	{
+		if (bytes > BufSize) [[unlikely]]
+		{
+			throw std::length_error{ std::format("Completion of {} bytes would exceed "
+				"the buffer size of {}", bytes, BufSize) };
+		}
+
+		buffers_[slot].resize_and_overwrite(bytes, [=](std::byte*, size_type) { return bytes; });
+	}
+
+	buffer_type& operator[](index_type slot) noexcept
+	{
+		return buffers_[slot];
+	}
+
+	const buffer_type& operator[](index_type slot) const noexcept
+	{
+		return buffers_[slot];
+	}
+
+	std::span<const iovec, Count> iovecs() const noexcept
+	{
+		return iovecs_;
+	}
+
+	static constexpr size_type buffer_size() noexcept
+	{
+		return BufSize;
+	}
+
+	static constexpr size_type size() noexcept
+	{
+		return Count;
+	}
+
+private:
+	static constexpr std::uint64_t pack(size_type slot, std::uint64_t tag) noexcept
+	{
+		return (tag << 32) | static_cast<std::uint64_t>(slot);
+	}
+
+	static constexpr index_type index_of(std::uint64_t head) noexcept
+	{
+		return static_cast<index_type>(head & 0xFFFF'FFFFu);
+	}
+
+	static constexpr std::uint64_t tag_of(std::uint64_t head) noexcept
+	{
+		return head >> 32;
+	}
+
+	std::array<buffer_type, Count> buffers_;
+	std::array<iovec, Count> iovecs_;
+	std::array<std::atomic<index_type>, Count> next_;
+	std::atomic<std::uint64_t> head_;
+};
+
+template<std::size_t BufSize, std::size_t Count>
+std::size_t pread_into(static_buffer_ring<BufSize, Count>& ring,
+	typename static_buffer_ring<BufSize, Count>::index_type slot, int fd, off_t offset)
+{
+	const std::size_t read = detail::retry_on_interrupt([&]
+		{
+			return ::pread(fd, ring[slot].data(), BufSize, offset);
+		}, "pread");
+
+	ring.complete(slot, read);
+	return read;
+}
+
+template<std::size_t BufSize, std::size_t Count>
+std::size_t pwrite_from(const static_buffer_ring<BufSize, Count>& ring,
+	typename static_buffer_ring<BufSize, Count>::index_type slot, int fd, off_t offset)
+{
+	return detail::retry_on_interrupt([&]
+		{
+			return ::pwrite(fd, ring[slot].data(), ring[slot].size(), offset);
+		}, "pwrite");
+}
+
+#if __has_include(<liburing.h>)
+
+template<std::size_t BufSize, std::size_t Count>
+void register_buffers(io_uring& uring, const static_buffer_ring<BufSize, Count>& ring)
+{
+	const int result = ::io_uring_register_buffers(&uring, ring.iovecs().data(),
+		static_cast<unsigned>(Count));
+	if (result < 0)
+	{
+		throw std::system_error{ -result, std::generic_category(), "io_uring_register_buffers" };
+	}
+}
+
+template<std::size_t BufSize, std::size_t Count>
+void prep_read_fixed(io_uring_sqe* sqe, static_buffer_ring<BufSize, Count>& ring,
+	typename static_buffer_ring<BufSize, Count>::index_type slot, int fd, std::uint64_t offset)
+{
+	::io_uring_prep_read_fixed(sqe, fd, ring[slot].data(), static_cast<unsigned>(BufSize),
+		offset, static_cast<int>(slot));
+	::io_uring_sqe_set_data(sqe, reinterpret_cast<void*>(static_cast<std::uintptr_t>(slot)));
+}
+
+template<std::size_t BufSize, std::size_t Count>
+void prep_write_fixed(io_uring_sqe* sqe, static_buffer_ring<BufSize, Count>& ring,
+	typename static_buffer_ring<BufSize, Count>::index_type slot, int fd, std::uint64_t offset)
+{
+	::io_uring_prep_write_fixed(sqe, fd, ring[slot].data(), static_cast<unsigned>(ring[slot].size()),
+		offset, static_cast<int>(slot));
+	::io_uring_sqe_set_data(sqe, reinterpret_cast<void*>(static_cast<std::uintptr_t>(slot)));
+}
+
+template<std::size_t BufSize, std::size_t Count>
+typename static_buffer_ring<BufSize, Count>::index_type
+	complete_read(static_buffer_ring<BufSize, Count>& ring, const io_uring_cqe* cqe)
+{
+	using index_type = typename static_buffer_ring<BufSize, Count>::index_type;
+
+	const auto slot = static_cast<index_type>(reinterpret_cast<std::uintptr_t>(
+		::io_uring_cqe_get_data(cqe)));
+	if (cqe->res < 0)
+	{
+		throw std::system_error{ -cqe->res, std::generic_category(), "io_uring read" };
+	}
+
+	ring.complete(slot, static_cast<std::size_t>(cqe->res));
+	return slot;
+}
+
+#endif
+
+#endif
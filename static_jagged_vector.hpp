@@ -0,0 +1,229 @@
+#pragma once
+
+#include <format>
+#include <initializer_list>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+
+#include "static_vector.hpp"
+
+template<typename T, std::size_t TotalCapacity, std::size_t MaxRows>
+class static_jagged_vector
+{
+private:
+	using offset_t = detail::smallest_size_type_t<TotalCapacity>;
+
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = T&;
+	using const_reference = const T&;
+	using pointer = T*;
+	using const_pointer = const T*;
+	using iterator = T*;
+	using const_iterator = const T*;
+	using row_type = std::span<T>;
+	using const_row_type = std::span<const T>;
+
+	constexpr static_jagged_vector()
+		: offsets_{ offset_t{ 0 } }
+	{
+	}
+
+	template<std::ranges::input_range Range>
+	constexpr void push_row(Range&& range)
+		requires (std::constructible_from<T, std::ranges::range_reference_t<Range>>)
+	{
+		check_row_capacity();
+
+		values_.insert_range(values_.cend(), std::forward<Range>(range));
+		offsets_.push_back(static_cast<offset_t>(values_.size()));
+	}
+
+	constexpr void push_row(std::initializer_list<T> init)
+	{
+		push_row(std::views::all(init));
+	}
+
+	constexpr void push_row()
+	{
+		check_row_capacity();
+
+		offsets_.push_back(static_cast<offset_t>(values_.size()));
+	}
+
+	constexpr void pop_row()
+		noexcept(std::is_nothrow_destructible_v<T>)
+	{
+		offsets_.pop_back();
+		values_.erase(values_.cbegin() + offsets_.back(), values_.cend());
+	}
+
+	template<typename ... Args>
+	requires std::is_constructible_v<T, Args...>
+	constexpr reference append_to_last_row(Args&& ... args)
+	{
+		check_has_rows();
+
+		reference value = values_.emplace_back(std::forward<Args>(args)...);
+		offsets_.back() = static_cast<offset_t>(values_.size());
+		return value;
+	}
+
+	constexpr void erase_row(size_type row)
+		noexcept (std::is_nothrow_move_assignable_v<T>)
+	{
+		const offset_t length = static_cast<offset_t>(offsets_[row + 1] - offsets_[row]);
+
+		values_.erase(values_.cbegin() + offsets_[row], values_.cbegin() + offsets_[row + 1]);
+		offsets_.erase(offsets_.cbegin() + row + 1);
+
+		for (size_type i = row + 1; i != offsets_.size(); ++i)
+		{
+			offsets_[i] -= length;
+		}
+	}
+
+	constexpr row_type operator[](size_type row) noexcept
+	{
+		return row_type{ values_.data() + offsets_[row], row_size(row) };
+	}
+
+	constexpr const_row_type operator[](size_type row) const noexcept
+	{
+		return const_row_type{ values_.data() + offsets_[row], row_size(row) };
+	}
+
+	constexpr row_type at(size_type row)
+	{
+		check_row_index(row);
+		return (*this)[row];
+	}
+
+	constexpr const_row_type at(size_type row) const
+	{
+		check_row_index(row);
+		return (*this)[row];
+	}
+
+	constexpr row_type back_row() noexcept
+	{
+		return (*this)[rows() - 1];
+	}
+
+	constexpr const_row_type back_row() const noexcept
+	{
+		return (*this)[rows() - 1];
+	}
+
+	constexpr size_type row_size(size_type row) const noexcept
+	{
+		return static_cast<size_type>(offsets_[row + 1] - offsets_[row]);
+	}
+
+	constexpr size_type rows() const noexcept
+	{
+		return offsets_.size() - 1;
+	}
+
+	constexpr size_type size() const noexcept
+	{
+		return values_.size();
+	}
+
+	constexpr size_type capacity() const noexcept
+	{
+		return TotalCapacity;
+	}
+
+	constexpr size_type max_rows() const noexcept
+	{
+		return MaxRows;
+	}
+
+	constexpr bool empty() const noexcept
+	{
+		return rows() == 0;
+	}
+
+	constexpr void clear()
+		noexcept(std::is_nothrow_destructible_v<T>)
+	{
+		values_.clear();
+		offsets_.resize(1);
+	}
+
+	constexpr pointer data() noexcept
+	{
+		return values_.data();
+	}
+
+	constexpr const_pointer data() const noexcept
+	{
+		return values_.data();
+	}
+
+	constexpr iterator begin() noexcept
+	{
+		return values_.begin();
+	}
+
+	constexpr iterator end() noexcept
+	{
+		return values_.end();
+	}
+
+	constexpr const_iterator begin() const noexcept
+	{
+		return values_.begin();
+	}
+
+	constexpr const_iterator end() const noexcept
+	{
+		return values_.end();
+	}
+
+	constexpr const_iterator cbegin() const noexcept
+	{
+		return values_.cbegin();
+	}
+
+	constexpr const_iterator cend() const noexcept
+	{
+		return values_.cend();
+	}
+
+private:
+	constexpr void check_row_capacity() const
+	{
+		if (rows() == max_rows()) [[unlikely]]
+		{
+			throw std::length_error{ std::format("Static jagged vector push_row call would "
+				"exceed the vector's row capacity of {}", max_rows()) };
+		}
+	}
+
+	constexpr void check_has_rows() const
+	{
+		if (empty()) [[unlikely]]
+		{
+			throw std::out_of_range{ "Static jagged vector append_to_last_row call "
+				"on a vector without rows" };
+		}
+	}
+
+	constexpr void check_row_index(size_type row) const
+	{
+		if (row >= rows()) [[unlikely]]
+		{
+			throw std::out_of_range{ std::format("Row {} is out of "
+				"the range of the vector. Range is [0, {})!",
+				row, rows()) };
+		}
+	}
+
+	static_vector<T, TotalCapacity> values_;
+	static_vector<offset_t, MaxRows + 1> offsets_;
+};
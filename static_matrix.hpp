@@ -0,0 +1,312 @@
+#pragma once
+
+#include <algorithm>
+#include <format>
+#include <mdspan>
+#include <stdexcept>
+
+#include "static_vector.hpp"
+
+namespace detail
+{
+	template<typename T>
+	constexpr std::size_t matrix_block_extent()
+	{
+		constexpr std::size_t l1_bytes = 32 * 1024;
+
+		std::size_t block = 1;
+		while (3 * (2 * block) * (2 * block) * sizeof(T) <= l1_bytes)
+		{
+			block *= 2;
+		}
+		return block;
+	}
+
+	template<typename T, std::size_t Elements>
+	inline constexpr bool fits_in_l1_v = Elements * sizeof(T) <= 32 * 1024;
+}
+
+template<std::size_t BlockRows, std::size_t BlockCols>
+struct layout_blocked
+{
+	template<typename Extents>
+	class mapping
+	{
+		static_assert(Extents::rank() == 2 && Extents::rank_dynamic() == 0,
+			"layout_blocked only supports statically sized matrices");
+		static_assert(Extents::static_extent(0) % BlockRows == 0
+			&& Extents::static_extent(1) % BlockCols == 0,
+			"Matrix extents must be a multiple of the block extents");
+
+	public:
+		using extents_type = Extents;
+		using index_type = typename Extents::index_type;
+		using size_type = typename Extents::size_type;
+		using rank_type = typename Extents::rank_type;
+		using layout_type = layout_blocked;
+
+		constexpr mapping() noexcept = default;
+
+		constexpr explicit mapping(const extents_type& extents) noexcept
+			: extents_{ extents }
+		{
+		}
+
+		constexpr const extents_type& extents() const noexcept
+		{
+			return extents_;
+		}
+
+		constexpr index_type required_span_size() const noexcept
+		{
+			return static_cast<index_type>(Extents::static_extent(0) * Extents::static_extent(1));
+		}
+
+		constexpr index_type operator()(index_type row, index_type col) const noexcept
+		{
+			constexpr index_type blocks_per_row = Extents::static_extent(1) / BlockCols;
+
+			const index_type block = (row / BlockRows) * blocks_per_row + col / BlockCols;
+			return block * (BlockRows * BlockCols) + (row % BlockRows) * BlockCols + col % BlockCols;
+		}
+
+		static constexpr bool is_always_unique() noexcept { return true; }
+		static constexpr bool is_always_exhaustive() noexcept { return true; }
+		static constexpr bool is_always_strided() noexcept { return false; }
+
+		static constexpr bool is_unique() noexcept { return true; }
+		static constexpr bool is_exhaustive() noexcept { return true; }
+		static constexpr bool is_strided() noexcept { return false; }
+
+		friend constexpr bool operator==(const mapping&, const mapping&) noexcept = default;
+
+	private:
+		[[no_unique_address]] extents_type extents_{};
+	};
+};
+
+template<typename T, std::size_t Rows, std::size_t Cols, typename Layout = std::layout_right>
+class static_matrix
+{
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+	using reference = T&;
+	using const_reference = const T&;
+	using pointer = T*;
+	using const_pointer = const T*;
+	using iterator = T*;
+	using const_iterator = const T*;
+	using extents_type = std::extents<std::size_t, Rows, Cols>;
+	using layout_type = Layout;
+	using mapping_type = typename Layout::template mapping<extents_type>;
+	using mdspan_type = std::mdspan<T, extents_type, Layout>;
+	using const_mdspan_type = std::mdspan<const T, extents_type, Layout>;
+
+	constexpr static_matrix()
+		: values_(Rows * Cols)
+	{
+	}
+
+	constexpr explicit static_matrix(const T& value)
+		: values_(Rows * Cols, value)
+	{
+	}
+
+	constexpr reference operator()(size_type row, size_type col) noexcept
+	{
+		return values_[mapping_type{}(row, col)];
+	}
+
+	constexpr const_reference operator()(size_type row, size_type col) const noexcept
+	{
+		return values_[mapping_type{}(row, col)];
+	}
+
+	constexpr mdspan_type mdspan() noexcept
+	{
+		return mdspan_type{ values_.data() };
+	}
+
+	constexpr const_mdspan_type mdspan() const noexcept
+	{
+		return const_mdspan_type{ values_.data() };
+	}
+
+	static constexpr size_type rows() noexcept
+	{
+		return Rows;
+	}
+
+	static constexpr size_type cols() noexcept
+	{
+		return Cols;
+	}
+
+	static constexpr size_type size() noexcept
+	{
+		return Rows * Cols;
+	}
+
+	constexpr pointer data() noexcept
+	{
+		return values_.data();
+	}
+
+	constexpr const_pointer data() const noexcept
+	{
+		return values_.data();
+	}
+
+	constexpr iterator begin() noexcept
+	{
+		return values_.begin();
+	}
+
+	constexpr iterator end() noexcept
+	{
+		return values_.end();
+	}
+
+	constexpr const_iterator begin() const noexcept
+	{
+		return values_.begin();
+	}
+
+	constexpr const_iterator end() const noexcept
+	{
+		return values_.end();
+	}
+
+	friend constexpr bool operator==(const static_matrix&, const static_matrix&) = default;
+
+private:
+	static_vector<T, Rows * Cols> values_;
+};
+
+template<typename T, std::size_t Rows, std::size_t Cols, typename Layout>
+constexpr static_matrix<T, Cols, Rows, Layout> transpose(const static_matrix<T, Rows, Cols, Layout>& matrix)
+{
+	static_matrix<T, Cols, Rows, Layout> result;
+
+	if constexpr (detail::fits_in_l1_v<T, 2 * Rows * Cols>)
+	{
+		for (std::size_t row = 0; row != Rows; ++row)
+		{
+			for (std::size_t col = 0; col != Cols; ++col)
+			{
+				result(col, row) = matrix(row, col);
+			}
+		}
+	}
+	else
+	{
+		constexpr std::size_t block = detail::matrix_block_extent<T>();
+
+		for (std::size_t row_block = 0; row_block < Rows; row_block += block)
+		{
+			for (std::size_t col_block = 0; col_block < Cols; col_block += block)
+			{
+				const std::size_t row_end = std::min(row_block + block, Rows);
+				const std::size_t col_end = std::min(col_block + block, Cols);
+
+				for (std::size_t row = row_block; row != row_end; ++row)
+				{
+					for (std::size_t col = col_block; col != col_end; ++col)
+					{
+						result(col, row) = matrix(row, col);
+					}
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+template<typename T, std::size_t Rows, std::size_t Inner, std::size_t Cols, typename Layout>
+constexpr static_matrix<T, Rows, Cols, Layout> multiply(const static_matrix<T, Rows, Inner, Layout>& lhs,
+	const static_matrix<T, Inner, Cols, Layout>& rhs)
+{
+	static_matrix<T, Rows, Cols, Layout> result;
+
+	if constexpr (detail::fits_in_l1_v<T, Rows * Inner + Inner * Cols + Rows * Cols>)
+	{
+		for (std::size_t row = 0; row != Rows; ++row)
+		{
+			for (std::size_t k = 0; k != Inner; ++k)
+			{
+				const T scale = lhs(row, k);
+				for (std::size_t col = 0; col != Cols; ++col)
+				{
+					result(row, col) += scale * rhs(k, col);
+				}
+			}
+		}
+	}
+	else
+	{
+		constexpr std::size_t block = detail::matrix_block_extent<T>();
+
+		for (std::size_t row_block = 0; row_block < Rows; row_block += block)
+		{
+			for (std::size_t k_block = 0; k_block < Inner; k_block += block)
+			{
+				for (std::size_t col_block = 0; col_block < Cols; col_block += block)
+				{
+					const std::size_t row_end = std::min(row_block + block, Rows);
+					const std::size_t k_end = std::min(k_block + block, Inner);
+					const std::size_t col_end = std::min(col_block + block, Cols);
+
+					for (std::size_t row = row_block; row != row_end; ++row)
+					{
+						for (std::size_t k = k_block; k != k_end; ++k)
+						{
+							const T scale = lhs(row, k);
+							for (std::size_t col = col_block; col != col_end; ++col)
+							{
+								result(row, col) += scale * rhs(k, col);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	return result;
+}
+
+template<typename Extents, typename Layout = std::layout_right, typename T, std::size_t Capacity>
+	requires (Extents::rank_dynamic() == 0)
+constexpr std::mdspan<T, Extents, Layout> as_mdspan(static_vector<T, Capacity>& vec)
+{
+	using mapping_type = typename Layout::template mapping<Extents>;
+	static_assert(static_cast<std::size_t>(mapping_type{}.required_span_size()) <= Capacity,
+		"Extents describe more elements than the static_vector can hold");
+
+	if (static_cast<std::size_t>(mapping_type{}.required_span_size()) > vec.size()) [[unlikely]]
+	{
+		throw std::length_error{ std::format("as_mdspan over {} elements requested from "
+			"a static_vector holding {} elements", mapping_type{}.required_span_size(), vec.size()) };
+	}
+
+	return std::mdspan<T, Extents, Layout>{ vec.data() };
+}
+
+template<typename Extents, typename Layout = std::layout_right, typename T, std::size_t Capacity>
+	requires (Extents::rank_dynamic() == 0)
+constexpr std::mdspan<const T, Extents, Layout> as_mdspan(const static_vector<T, Capacity>& vec)
+{
+	using mapping_type = typename Layout::template mapping<Extents>;
+	static_assert(static_cast<std::size_t>(mapping_type{}.required_span_size()) <= Capacity,
+		"Extents describe more elements than the static_vector can hold");
+
+	if (static_cast<std::size_t>(mapping_type{}.required_span_size()) > vec.size()) [[unlikely]]
+	{
+		throw std::length_error{ std::format("as_mdspan over {} elements requested from "
+			"a static_vector holding {} elements", mapping_type{}.required_span_size(), vec.size()) };
+	}
+
+	return std::mdspan<const T, Extents, Layout>{ vec.data() };
+}
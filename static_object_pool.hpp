@@ -0,0 +1,238 @@
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <format>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "static_vector.hpp"
+
+template<typename T, std::size_t Capacity>
+class static_object_pool
+{
+private:
+	using index_t = detail::smallest_size_type_t<Capacity>;
+	using word_t = std::uint64_t;
+
+	static constexpr index_t npos = static_cast<index_t>(Capacity);
+	static constexpr std::size_t word_bits = 64;
+	static constexpr std::size_t word_count = (Capacity + word_bits - 1) / word_bits;
+
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+	using pointer = T*;
+	using const_pointer = const T*;
+
+	class handle
+	{
+	public:
+		constexpr handle() noexcept = default;
+
+		constexpr handle(handle&& other) noexcept
+			: pool_{ std::exchange(other.pool_, nullptr) }
+			, ptr_{ std::exchange(other.ptr_, nullptr) }
+		{
+		}
+
+		constexpr handle& operator=(handle&& other) noexcept
+		{
+			if (this != std::addressof(other)) [[likely]]
+			{
+				reset();
+				pool_ = std::exchange(other.pool_, nullptr);
+				ptr_ = std::exchange(other.ptr_, nullptr);
+			}
+			return *this;
+		}
+
+		constexpr ~handle()
+		{
+			reset();
+		}
+
+		constexpr void reset() noexcept
+		{
+			if (ptr_ != nullptr)
+			{
+				pool_->destroy(std::exchange(ptr_, nullptr));
+			}
+		}
+
+		constexpr pointer release() noexcept
+		{
+			return std::exchange(ptr_, nullptr);
+		}
+
+		constexpr pointer get() const noexcept
+		{
+			return ptr_;
+		}
+
+		constexpr T& operator*() const noexcept
+		{
+			return *ptr_;
+		}
+
+		constexpr pointer operator->() const noexcept
+		{
+			return ptr_;
+		}
+
+		constexpr explicit operator bool() const noexcept
+		{
+			return ptr_ != nullptr;
+		}
+
+	private:
+		friend static_object_pool;
+
+		constexpr handle(static_object_pool* pool, pointer ptr) noexcept
+			: pool_{ pool }
+			, ptr_{ ptr }
+		{
+		}
+
+		static_object_pool* pool_ = nullptr;
+		pointer ptr_ = nullptr;
+	};
+
+	constexpr static_object_pool() noexcept = default;
+
+	static_object_pool(const static_object_pool&) = delete;
+	static_object_pool& operator=(const static_object_pool&) = delete;
+
+	template<typename ... Args>
+	requires std::is_constructible_v<T, Args...>
+	constexpr pointer create(Args&& ... args)
+	{
+		if (size() == capacity()) [[unlikely]]
+		{
+			throw std::length_error{ std::format("Static object pool create call would "
+				"exceed the pool's capacity of {}", capacity()) };
+		}
+
+		const index_t index = free_head_ != npos ? free_head_ : used_slots_;
+		std::construct_at(data_ + index, std::forward<Args>(args)...);
+
+		if (index == free_head_)
+		{
+			free_head_ = next_free_[index];
+		}
+		else
+		{
+			++used_slots_;
+		}
+
+		live_[index / word_bits] |= word_t{ 1 } << (index % word_bits);
+		++size_;
+
+		return data_ + index;
+	}
+
+	template<typename ... Args>
+	requires std::is_constructible_v<T, Args...>
+	constexpr handle make(Args&& ... args)
+	{
+		return handle{ this, create(std::forward<Args>(args)...) };
+	}
+
+	constexpr void destroy(pointer obj)
+		noexcept(std::is_nothrow_destructible_v<T>)
+	{
+		const index_t index = index_of(obj);
+
+		std::destroy_at(obj);
+
+		live_[index / word_bits] &= ~(word_t{ 1 } << (index % word_bits));
+		next_free_[index] = free_head_;
+		free_head_ = index;
+		--size_;
+	}
+
+	template<typename Function>
+	constexpr void for_each(Function fn)
+	{
+		for (size_type word = 0; word != word_count; ++word)
+		{
+			for (word_t bits = live_[word]; bits != 0; bits &= bits - 1)
+			{
+				std::invoke(fn, data_[word * word_bits + std::countr_zero(bits)]);
+			}
+		}
+	}
+
+	template<typename Function>
+	constexpr void for_each(Function fn) const
+	{
+		for (size_type word = 0; word != word_count; ++word)
+		{
+			for (word_t bits = live_[word]; bits != 0; bits &= bits - 1)
+			{
+				std::invoke(fn, std::as_const(data_[word * word_bits + std::countr_zero(bits)]));
+			}
+		}
+	}
+
+	constexpr void clear()
+		noexcept(std::is_nothrow_destructible_v<T>)
+	{
+		for_each([](T& obj) { std::destroy_at(std::addressof(obj)); });
+
+		live_.fill(0);
+		free_head_ = npos;
+		used_slots_ = 0;
+		size_ = 0;
+	}
+
+	constexpr size_type size() const noexcept
+	{
+		return static_cast<size_type>(size_);
+	}
+
+	constexpr size_type capacity() const noexcept
+	{
+		return Capacity;
+	}
+
+	constexpr bool empty() const noexcept
+	{
+		return size_ == 0;
+	}
+
+	constexpr bool full() const noexcept
+	{
+		return size() == capacity();
+	}
+
+	constexpr ~static_object_pool()
+	noexcept(std::is_nothrow_destructible_v<T>)
+	requires(not std::is_trivially_destructible_v<T>)
+	{
+		clear();
+	}
+
+	constexpr ~static_object_pool() noexcept
+	requires(std::is_trivially_destructible_v<T>)
+		= default;
+
+private:
+	constexpr index_t index_of(const_pointer obj) const noexcept
+	{
+		return static_cast<index_t>(obj - data_);
+	}
+
+	union {
+		std::byte dummy_{};
+		T data_[Capacity == 0 ? 1 : Capacity];
+	};
+	std::array<index_t, Capacity> next_free_{};
+	std::array<word_t, word_count> live_{};
+	index_t free_head_ = npos;
+	index_t used_slots_ = 0;
+	index_t size_ = 0;
+};
@@ -0,0 +1,230 @@
+#pragma once
+
+#include <algorithm>
+#include <format>
+#include <functional>
+#include <ranges>
+#include <stdexcept>
+
+#include "static_vector.hpp"
+
+template<typename T, std::size_t Capacity, typename Compare = std::less<T>, std::size_t Arity = 4>
+class static_priority_queue
+{
+	static_assert(Arity >= 2, "A heap needs at least two children per node");
+
+public:
+	using container_type = static_vector<T, Capacity>;
+	using value_compare = Compare;
+	using value_type = T;
+	using size_type = std::size_t;
+	using reference = T&;
+	using const_reference = const T&;
+
+	constexpr static_priority_queue() = default;
+
+	constexpr explicit static_priority_queue(const Compare& comp)
+		: comp_{ comp }
+	{
+	}
+
+	template<std::ranges::input_range Range>
+	constexpr static_priority_queue(std::from_range_t, Range&& range, const Compare& comp = Compare{})
+		: comp_{ comp }
+	{
+		heapify(std::forward<Range>(range));
+	}
+
+	constexpr const_reference top() const noexcept
+	{
+		return c_[0];
+	}
+
+	constexpr size_type size() const noexcept
+	{
+		return c_.size();
+	}
+
+	constexpr size_type capacity() const noexcept
+	{
+		return Capacity;
+	}
+
+	constexpr bool empty() const noexcept
+	{
+		return c_.empty();
+	}
+
+	constexpr void push(const T& value)
+	{
+		c_.push_back(value);
+		sift_up(c_.size() - 1);
+	}
+
+	constexpr void push(T&& value)
+	{
+		c_.push_back(std::move(value));
+		sift_up(c_.size() - 1);
+	}
+
+	template<typename ... Args>
+	requires std::is_constructible_v<T, Args...>
+	constexpr void emplace(Args&& ... args)
+	{
+		c_.emplace_back(std::forward<Args>(args)...);
+		sift_up(c_.size() - 1);
+	}
+
+	constexpr void pop()
+	{
+		if (c_.size() > 1)
+		{
+			c_[0] = std::move(c_.back());
+			c_.pop_back();
+			sift_down(0);
+		}
+		else
+		{
+			c_.pop_back();
+		}
+	}
+
+	constexpr void replace_top(T value)
+	{
+		c_[0] = std::move(value);
+		sift_down(0);
+	}
+
+	constexpr T push_pop(T value)
+	{
+		if (c_.empty() || not std::invoke(comp_, value, c_[0]))
+		{
+			return value;
+		}
+
+		std::ranges::swap(value, c_[0]);
+		sift_down(0);
+
+		return value;
+	}
+
+	constexpr void push_bounded(T value)
+	{
+		if (c_.size() < Capacity)
+		{
+			push(std::move(value));
+		}
+		else if (Capacity != 0 && std::invoke(comp_, value, c_[0]))
+		{
+			replace_top(std::move(value));
+		}
+	}
+
+	template<std::ranges::input_range Range>
+	constexpr void heapify(Range&& range)
+	{
+		c_.assign_range(std::forward<Range>(range));
+
+		if (c_.size() > 1)
+		{
+			for (size_type i = (c_.size() - 2) / Arity + 1; i-- > 0;)
+			{
+				sift_down(i);
+			}
+		}
+	}
+
+	constexpr void clear()
+		noexcept(std::is_nothrow_destructible_v<T>)
+	{
+		c_.clear();
+	}
+
+	constexpr const container_type& container() const noexcept
+	{
+		return c_;
+	}
+
+	constexpr container_type extract_sorted()
+	{
+		container_type sorted;
+		while (not c_.empty())
+		{
+			sorted.push_back(std::move(c_[0]));
+			pop();
+		}
+		std::ranges::reverse(sorted);
+		return sorted;
+	}
+
+private:
+	constexpr void sift_up(size_type i)
+	{
+		if (i == 0)
+		{
+			return;
+		}
+
+		T value = std::move(c_[i]);
+		while (i > 0)
+		{
+			const size_type parent = (i - 1) / Arity;
+			if (not std::invoke(comp_, c_[parent], value))
+			{
+				break;
+			}
+			c_[i] = std::move(c_[parent]);
+			i = parent;
+		}
+		c_[i] = std::move(value);
+	}
+
+	constexpr void sift_down(size_type i)
+	{
+		const size_type count = c_.size();
+		T value = std::move(c_[i]);
+
+		while (true)
+		{
+			const size_type first = Arity * i + 1;
+			if (first >= count)
+			{
+				break;
+			}
+
+			const size_type last = std::min(first + Arity, count);
+			size_type best = first;
+			for (size_type child = first + 1; child < last; ++child)
+			{
+				if (std::invoke(comp_, c_[best], c_[child]))
+				{
+					best = child;
+				}
+			}
+
+			if (not std::invoke(comp_, value, c_[best]))
+			{
+				break;
+			}
+			c_[i] = std::move(c_[best]);
+			i = best;
+		}
+		c_[i] = std::move(value);
+	}
+
+	container_type c_;
+	[[no_unique_address]] Compare comp_{};
+};
+
+template<std::size_t K, typename Compare = std::less<>, std::ranges::input_range Range>
+constexpr static_vector<std::ranges::range_value_t<Range>, K> top_k(Range&& range, Compare comp = {})
+{
+	static_priority_queue<std::ranges::range_value_t<Range>, K, Compare> heap{ comp };
+
+	for (auto&& val : range)
+	{
+		heap.push_bounded(std::forward<decltype(val)>(val));
+	}
+
+	return heap.extract_sorted();
+}
@@ -0,0 +1,248 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <format>
+#include <stdexcept>
+
+#include "static_vector.hpp"
+
+template<typename T, std::size_t Capacity>
+class static_slot_map
+{
+private:
+	using index_t = detail::smallest_size_type_t<Capacity>;
+	using generation_t = std::uint32_t;
+
+	static constexpr index_t npos = static_cast<index_t>(Capacity);
+
+	struct slot
+	{
+		index_t index = npos;
+		generation_t generation = 0;
+	};
+
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+	using difference_type = std::ptrdiff_t;
+	using reference = T&;
+	using const_reference = const T&;
+	using pointer = T*;
+	using const_pointer = const T*;
+	using iterator = typename static_vector<T, Capacity>::iterator;
+	using const_iterator = typename static_vector<T, Capacity>::const_iterator;
+
+	struct handle
+	{
+		index_t index = npos;
+		generation_t generation = 0;
+
+		friend constexpr bool operator==(const handle&, const handle&) noexcept = default;
+	};
+
+	constexpr static_slot_map() noexcept = default;
+
+	constexpr handle insert(const T& value)
+	{
+		return emplace(value);
+	}
+
+	constexpr handle insert(T&& value)
+	{
+		return emplace(std::move(value));
+	}
+
+	template<typename ... Args>
+	requires std::is_constructible_v<T, Args...>
+	constexpr handle emplace(Args&& ... args)
+	{
+		if (size() == capacity()) [[unlikely]]
+		{
+			throw std::length_error{ std::format("Static slot map emplace call would "
+				"exceed the map's capacity of {}", capacity()) };
+		}
+
+		const index_t slot_index = free_head_ != npos ? free_head_ : used_slots_;
+
+		values_.emplace_back(std::forward<Args>(args)...);
+
+		slot& s = slots_[slot_index];
+		if (slot_index == free_head_)
+		{
+			free_head_ = s.index;
+		}
+		else
+		{
+			++used_slots_;
+		}
+
+		s.index = static_cast<index_t>(values_.size() - 1);
+		++s.generation;
+		dense_to_slot_[s.index] = slot_index;
+
+		return handle{ slot_index, s.generation };
+	}
+
+	constexpr bool erase(handle h)
+		noexcept (std::is_nothrow_move_assignable_v<T>)
+	{
+		if (not contains(h))
+		{
+			return false;
+		}
+
+		slot& s = slots_[h.index];
+		const index_t last = static_cast<index_t>(values_.size() - 1);
+
+		if (s.index != last)
+		{
+			values_[s.index] = std::move(values_.back());
+			dense_to_slot_[s.index] = dense_to_slot_[last];
+			slots_[dense_to_slot_[s.index]].index = s.index;
+		}
+
+		values_.pop_back();
+
+		++s.generation;
+		s.index = free_head_;
+		free_head_ = h.index;
+
+		return true;
+	}
+
+	constexpr bool contains(handle h) const noexcept
+	{
+		return h.index < used_slots_ && slots_[h.index].generation == h.generation
+			&& h.generation % 2 == 1;
+	}
+
+	constexpr pointer find(handle h) noexcept
+	{
+		return contains(h) ? values_.data() + slots_[h.index].index : nullptr;
+	}
+
+	constexpr const_pointer find(handle h) const noexcept
+	{
+		return contains(h) ? values_.data() + slots_[h.index].index : nullptr;
+	}
+
+	constexpr reference operator[](handle h) noexcept
+	{
+		return values_[slots_[h.index].index];
+	}
+
+	constexpr const_reference operator[](handle h) const noexcept
+	{
+		return values_[slots_[h.index].index];
+	}
+
+	constexpr reference at(handle h)
+	{
+		if (not contains(h)) [[unlikely]]
+		{
+			throw std::out_of_range{ std::format("Handle {{{}, {}}} does not refer "
+				"to a live element of the slot map!", h.index, h.generation) };
+		}
+
+		return values_[slots_[h.index].index];
+	}
+
+	constexpr const_reference at(handle h) const
+	{
+		if (not contains(h)) [[unlikely]]
+		{
+			throw std::out_of_range{ std::format("Handle {{{}, {}}} does not refer "
+				"to a live element of the slot map!", h.index, h.generation) };
+		}
+
+		return values_[slots_[h.index].index];
+	}
+
+	constexpr handle handle_of(const_iterator pos) const noexcept
+	{
+		const index_t slot_index = dense_to_slot_[std::distance(values_.cbegin(), pos)];
+		return handle{ slot_index, slots_[slot_index].generation };
+	}
+
+	constexpr void clear()
+		noexcept(std::is_nothrow_destructible_v<T>)
+	{
+		for (size_type i = 0; i != values_.size(); ++i)
+		{
+			slot& s = slots_[dense_to_slot_[i]];
+			++s.generation;
+			s.index = free_head_;
+			free_head_ = dense_to_slot_[i];
+		}
+
+		values_.clear();
+	}
+
+	constexpr size_type size() const noexcept
+	{
+		return values_.size();
+	}
+
+	constexpr size_type capacity() const noexcept
+	{
+		return Capacity;
+	}
+
+	constexpr size_type max_size() const noexcept
+	{
+		return capacity();
+	}
+
+	constexpr bool empty() const noexcept
+	{
+		return values_.empty();
+	}
+
+	constexpr pointer data() noexcept
+	{
+		return values_.data();
+	}
+
+	constexpr const_pointer data() const noexcept
+	{
+		return values_.data();
+	}
+
+	constexpr iterator begin() noexcept
+	{
+		return values_.begin();
+	}
+
+	constexpr iterator end() noexcept
+	{
+		return values_.end();
+	}
+
+	constexpr const_iterator begin() const noexcept
+	{
+		return values_.begin();
+	}
+
+	constexpr const_iterator end() const noexcept
+	{
+		return values_.end();
+	}
+
+	constexpr const_iterator cbegin() const noexcept
+	{
+		return values_.cbegin();
+	}
+
+	constexpr const_iterator cend() const noexcept
+	{
+		return values_.cend();
+	}
+
+private:
+	static_vector<T, Capacity> values_;
+	std::array<index_t, Capacity> dense_to_slot_{};
+	std::array<slot, Capacity> slots_{};
+	index_t free_head_ = npos;
+	index_t used_slots_ = 0;
+};
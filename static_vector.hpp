@@ -1,9 +1,20 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <charconv>
+#include <compare>
 #include <concepts>
+#include <cstring>
 #include <format>
+#include <functional>
+#include <memory>
+#include <ranges>
+#include <stdexcept>
+#include <string_view>
+#include <system_error>
 #include <type_traits>
+#include <utility>
 
 namespace detail
 {
@@ -26,22 +37,50 @@ namespace detail
 	template<std::size_t Max>
 	using smallest_size_type_t = typename smallest_size_type<Max>::type;
 
-	template<std::input_iterator InputIt, std::integral Size, std::forward_iterator ForwardIt>
-	constexpr ForwardIt constexpr_uninitialized_copy_n(InputIt first, Size count, ForwardIt d_first)
+	template<typename T>
+	inline constexpr bool is_bitwise_comparable_v = std::is_scalar_v<T>
+		&& std::has_unique_object_representations_v<T>;
+
+	template<typename T, typename ... Args>
+	inline constexpr bool may_refer_to_element_v = ((std::is_lvalue_reference_v<Args>
+		&& std::is_convertible_v<std::remove_reference_t<Args>*, const T*>) || ...);
+
+	template<typename Range>
+	inline constexpr bool is_expiring_range_v = not std::is_lvalue_reference_v<Range>
+		&& not std::ranges::view<std::remove_cvref_t<Range>>;
+
+	template<typename T>
+	inline constexpr bool is_memcmp_orderable_v = sizeof(T) == 1
+		&& (std::is_unsigned_v<T> || std::is_same_v<T, std::byte>);
+
+	template<std::forward_iterator ForwardIt, std::integral Size>
+	constexpr ForwardIt constexpr_destroy_n(ForwardIt first, Size count)
+	{
+		if constexpr (std::is_trivially_destructible_v<std::iter_value_t<ForwardIt>>)
+		{
+			return std::ranges::next(first, count);
+		}
+		else
+		{
+			return std::destroy_n(std::move(first), count);
+		}
+	}
+
+	template<std::input_iterator InputIt, std::integral Size, typename T>
+	constexpr T* constexpr_uninitialized_copy_n(InputIt first, Size count, T* d_first)
 	{
 		if (not std::is_constant_evaluated())
 		{
 			return std::uninitialized_copy_n(std::move(first),
-				std::move(count), std::move(d_first));
+				std::move(count), d_first);
 		}
 
-		using T = std::iter_value_t<ForwardIt>;
-		ForwardIt current = d_first;
+		T* current = d_first;
 		try
 		{
 			for (; count > 0; ++first, (void) ++current, --count)
 			{
-				std::construct_at(std::to_address(current), *first);
+				std::construct_at(current, *first);
 			}
 		}
 		catch (...)
@@ -52,23 +91,21 @@ namespace detail
 		return current;
 	}
 
-	template<std::input_iterator InputIt, std::integral Size, std::forward_iterator ForwardIt>
-	constexpr std::pair<InputIt, ForwardIt>
-		constexpr_uninitialized_move_n(InputIt first, Size count, ForwardIt d_first)
+	template<std::input_iterator InputIt, std::integral Size, typename T>
+	constexpr std::pair<InputIt, T*> constexpr_uninitialized_move_n(InputIt first, Size count, T* d_first)
 	{
 		if (not std::is_constant_evaluated())
 		{
 			return std::uninitialized_move_n(std::move(first),
-				std::move(count), std::move(d_first));
+				std::move(count), d_first);
 		}
 
-		using Value = std::iter_value_t<ForwardIt>;
-		ForwardIt current = d_first;
+		T* current = d_first;
 		try
 		{
 			for (; count > 0; ++first, (void) ++current, --count)
 			{
-				std::construct_at(std::to_address(current), std::move(*first));
+				std::construct_at(current, std::ranges::iter_move(first));
 			}
 		}
 		catch (...)
@@ -76,59 +113,153 @@ namespace detail
 			std::destroy(d_first, current);
 			throw;
 		}
-		return { first, current };
+		return { std::move(first), current };
 	}
 
-	template<std::forward_iterator ForwardIt, std::integral Size>
-	constexpr ForwardIt constexpr_uninitialized_value_construct_n(ForwardIt first, Size n)
+	template<std::integral Size, typename T>
+	constexpr T* constexpr_uninitialized_value_construct_n(T* first, Size count)
 	{
 		if (not std::is_constant_evaluated())
 		{
-			return std::uninitialized_value_construct_n(std::move(first), std::move(n));
+			return std::uninitialized_value_construct_n(first, std::move(count));
 		}
 
-		using T = std::iter_value_t<ForwardIt>;
-
-		ForwardIt current = first;
+		T* current = first;
 		try
 		{
-			for (; n > 0; (void) ++current, --n)
+			for (; count > 0; ++current, (void) --count)
 			{
-				std::construct_at(std::to_address(current), T{});
+				std::construct_at(current);
 			}
-			return current;
 		}
 		catch (...)
 		{
 			std::destroy(first, current);
 			throw;
 		}
+		return current;
 	}
 
-	template<std::forward_iterator ForwardIt, std::integral Size, typename T>
-	constexpr ForwardIt constexpr_uninitialized_fill_n(ForwardIt first, Size count, const T& value)
+	template<std::integral Size, typename T, typename U>
+	constexpr T* constexpr_uninitialized_fill_n(T* first, Size count, const U& value)
 	{
 		if (not std::is_constant_evaluated())
 		{
-			return std::uninitialized_fill_n(std::move(first),
-				std::move(count), value);;
+			return std::uninitialized_fill_n(first,
+				std::move(count), value);
 		}
 
-		using V = std::iter_value_t<ForwardIt>;
-		ForwardIt current = first;
-		try 
+		T* current = first;
+		try
 		{
 			for (; count > 0; ++current, (void) --count)
 			{
-				std::construct_at(std::to_address(current), value);
+				std::construct_at(current, value);
+			}
+		}
+		catch (...)
+		{
+			std::destroy(first, current);
+			throw;
+		}
+		return current;
+	}
+
+	template<std::integral Size, typename T, typename Function>
+	constexpr T* constexpr_uninitialized_generate_n(T* first, Size count, Function fn)
+	{
+		T* current = first;
+		try
+		{
+			for (Size i = 0; i != count; ++current, (void) ++i)
+			{
+				std::construct_at(current, std::invoke(fn, i));
 			}
-			return current;
 		}
-		catch (...) 
+		catch (...)
 		{
 			std::destroy(first, current);
 			throw;
 		}
+		return current;
+	}
+
+	template<std::random_access_iterator It, typename Compare>
+	constexpr void merge_without_buffer(It first, It middle, It last, Compare& comp)
+	{
+		while (first != middle && middle != last)
+		{
+			if (last - first == 2)
+			{
+				if (std::invoke(comp, *middle, *first))
+				{
+					std::iter_swap(first, middle);
+				}
+				return;
+			}
+
+			It left_cut;
+			It right_cut;
+			if (middle - first > last - middle)
+			{
+				left_cut = first + (middle - first) / 2;
+				right_cut = std::lower_bound(middle, last, *left_cut, std::ref(comp));
+			}
+			else
+			{
+				right_cut = middle + (last - middle) / 2;
+				left_cut = std::upper_bound(first, middle, *right_cut, std::ref(comp));
+			}
+
+			const It new_middle = std::rotate(left_cut, middle, right_cut);
+			merge_without_buffer(first, left_cut, new_middle, comp);
+
+			first = new_middle;
+			middle = right_cut;
+		}
+	}
+
+	template<typename It>
+	inline constexpr bool is_move_iterator_v = false;
+
+	template<typename It>
+	inline constexpr bool is_move_iterator_v<std::move_iterator<It>> = true;
+
+	template<bool Move, std::input_iterator InputIt, std::integral Size, std::forward_iterator ForwardIt>
+	constexpr ForwardIt constexpr_uninitialized_transfer_n(InputIt first, Size count, ForwardIt d_first)
+	{
+		using T = std::iter_value_t<ForwardIt>;
+
+		if constexpr (is_move_iterator_v<InputIt>)
+		{
+			return constexpr_uninitialized_transfer_n<true>(std::move(first).base(), count, d_first);
+		}
+		else
+		{
+			if constexpr (std::contiguous_iterator<InputIt> && std::contiguous_iterator<ForwardIt>
+				&& std::is_trivially_copyable_v<T>
+				&& std::is_same_v<std::remove_cvref_t<std::iter_reference_t<InputIt>>, T>)
+			{
+				if (not std::is_constant_evaluated())
+				{
+					if (count > 0)
+					{
+						std::memcpy(std::to_address(d_first), std::to_address(first),
+							static_cast<std::size_t>(count) * sizeof(T));
+					}
+					return d_first + count;
+				}
+			}
+
+			if constexpr (Move)
+			{
+				return constexpr_uninitialized_move_n(std::move(first), count, d_first).second;
+			}
+			else
+			{
+				return constexpr_uninitialized_copy_n(std::move(first), count, d_first);
+			}
+		}
 	}
 }
 
@@ -233,14 +364,15 @@ public:
 	{
 		if constexpr (std::forward_iterator<InputIt>)
 		{
-			size_ = std::distance(first, last);
-			if (size_ > Capacity) [[unlikely]]
+			const size_type count = static_cast<size_type>(std::distance(first, last));
+			if (count > Capacity) [[unlikely]]
 			{
 				throw std::length_error(std::format("Attempting to construct static_vector with a "
-					"max capacity of {} from a range of {} elements", Capacity, size_));
+					"max capacity of {} from a range of {} elements", Capacity, count));
 			}
 
-			detail::constexpr_uninitialized_copy_n(first, size, data());
+			detail::constexpr_uninitialized_transfer_n<false>(std::move(first), count, data());
+			size_ = static_cast<real_size_t>(count);
 		}
 		else
 		{
@@ -257,21 +389,20 @@ public:
 	{
 		if constexpr (std::ranges::sized_range<Range> || std::ranges::forward_range<Range>)
 		{
-			size_ = std::ranges::distance(range);
-			if (size_ > Capacity) [[unlikely]]
+			const size_type count = static_cast<size_type>(std::ranges::distance(range));
+			if (count > Capacity) [[unlikely]]
 			{
 				throw std::length_error(std::format("Attempting to construct static_vector with a "
-					"max capacity of {} from a range of {} elements", Capacity, size_));
+					"max capacity of {} from a range of {} elements", Capacity, count));
 			}
 
-			detail::constexpr_uninitialized_copy_n(std::ranges::begin(range), size, data());
+			detail::constexpr_uninitialized_transfer_n<detail::is_expiring_range_v<Range>>(
+				std::ranges::begin(range), count, data());
+			size_ = static_cast<real_size_t>(count);
 		}
 		else
 		{
-			for (auto&& val : range)
-			{
-				emplace_back(std::forward<decltype(val)>(val));
-			}
+			append_range(std::forward<Range>(range));
 		}
 	}
 
@@ -304,7 +435,7 @@ public:
 
 		std::ranges::copy_n(other.cbegin(), min_size, begin());
 		detail::constexpr_uninitialized_copy_n(other.cbegin() + min_size, other.size() - min_size, new_end);
-		std::destroy_n(new_end, size() - min_size);
+		detail::constexpr_destroy_n(new_end, size() - min_size);
 
 		size_ = static_cast<real_size_t>(other.size());
 
@@ -325,7 +456,7 @@ public:
 
 		std::ranges::copy_n(std::make_move_iterator(other.begin()), min_size, begin());
 		detail::constexpr_uninitialized_move_n(other.begin() + min_size, other.size() - min_size, new_end);
-		std::destroy_n(new_end, size() - min_size);
+		detail::constexpr_destroy_n(new_end, size() - min_size);
 
 		size_ = static_cast<real_size_t>(other.size());
 
@@ -344,8 +475,8 @@ public:
 
 		detail::constexpr_uninitialized_move_n(other.begin() + min_size, other.size() - min_size, data() + size());
 		detail::constexpr_uninitialized_move_n(begin() + min_size, size() - min_size, other.data() + other.size());
-		std::destroy_n(other.data() + min_size, other.size() - min_size);
-		std::destroy_n(data() + min_size, size() - min_size);
+		detail::constexpr_destroy_n(other.data() + min_size, other.size() - min_size);
+		detail::constexpr_destroy_n(data() + min_size, size() - min_size);
 
 		std::swap(size_, other.size_);
 	}
@@ -364,7 +495,7 @@ public:
 		std::ranges::copy_n(init.begin(), min_size, begin());
 		detail::constexpr_uninitialized_copy_n(
 			init.begin() + min_size, init.size() - min_size, data() + size());
-		std::destroy_n(data() + size(), size() - min_size);
+		detail::constexpr_destroy_n(data() + min_size, size() - min_size);
 
 		size_ = static_cast<real_size_t>(init.size());
 	}
@@ -382,7 +513,7 @@ public:
 
 		std::ranges::fill_n(begin(), min_size, value);
 		detail::constexpr_uninitialized_fill_n(data() + size(), count - min_size, value);
-		std::destroy_n(data() + size(), size() - min_size);
+		detail::constexpr_destroy_n(data() + min_size, size() - min_size);
 
 		size_ = static_cast<real_size_t>(count);
 	}
@@ -404,19 +535,27 @@ public:
 
 			const size_type min_size = std::min(size(), rsize);
 
-			auto [it, _] = std::ranges::copy_n(std::ranges::begin(range), min_size, begin());
-			detail::constexpr_uninitialized_copy_n(std::move(it), rsize - min_size, data() + size());
-			std::destroy_n(data() + size(), size() - min_size);
+			if constexpr (detail::is_expiring_range_v<Range>)
+			{
+				auto [it, _] = std::ranges::copy_n(
+					std::make_move_iterator(std::ranges::begin(range)), min_size, begin());
+				detail::constexpr_uninitialized_transfer_n<true>(
+					std::move(it).base(), rsize - min_size, data() + size());
+			}
+			else
+			{
+				auto [it, _] = std::ranges::copy_n(std::ranges::begin(range), min_size, begin());
+				detail::constexpr_uninitialized_transfer_n<false>(
+					std::move(it), rsize - min_size, data() + size());
+			}
+			detail::constexpr_destroy_n(data() + min_size, size() - min_size);
 
 			size_ = static_cast<real_size_t>(rsize);
 		}
 		else
 		{
 			clear();
-			for (auto&& val : range)
-			{
-				emplace_back(std::forward<decltype(val)>(val));
-			}
+			append_range(std::forward<Range>(range));
 		}
 	}
 
@@ -483,80 +622,22 @@ public:
 
 	constexpr reference front() noexcept
 	{
-		return &data_[0];
+		return data_[0];
 	}
 
 	constexpr const_reference front() const noexcept
 	{
-		return &data_[0];
+		return data_[0];
 	}
 
 	constexpr iterator insert(const_iterator pos, const T& value)
 	{
-		if (size() == capacity()) [[unlikely]]
-		{
-			throw std::length_error{ std::format("Static vector insert call would "
-				"exceed the vector's capacity of {}", Capacity) };
-		}
-
-		if (pos == cend()) [[unlikely]]
-		{
-			push_back(value);
-			return begin() + std::distance(cbegin(), pos);
-		}
-
-		std::construct_at(data() + size(), std::move(back()));
-
-		iterator it = begin() + std::distance(cbegin(), pos);
-		std::ranges::move_backward(it, end() - 1, it + 1);
-
-		try
-		{
-			*it = value;
-		}
-		catch (...)
-		{
-			std::ranges::move(it + 1, end() + 1, it);
-			throw;
-		}
-
-		++size_;
-
-		return it;
+		return emplace(pos, value);
 	}
 
 	constexpr iterator insert(const_iterator pos, T&& value)
 	{
-		if (size() == capacity()) [[unlikely]]
-		{
-			throw std::length_error{ std::format("Static vector insert call would "
-				"exceed the vector's capacity of {}", capacity()) };
-		}
-
-		if (pos == cend()) [[unlikely]]
-		{
-			push_back(std::move(value));
-			return begin() + std::distance(cbegin(), pos);
-		}
-
-		std::construct_at(data() + size(), std::move(back()));
-
-		iterator it = begin() + std::distance(cbegin(), pos);
-		std::ranges::move_backward(it, end() - 1, end());
-
-		try
-		{
-			*it = std::move(value);
-		}
-		catch (...)
-		{
-			std::ranges::move(it + 1, end() + 1, it);
-			throw;
-		}
-
-		++size_;
-
-		return it;
+		return emplace(pos, std::move(value));
 	}
 
 	template<typename ... Args>
@@ -574,24 +655,18 @@ public:
 			return begin() + std::distance(cbegin(), pos);
 		}
 
-		std::construct_at(data() + size(), std::move(back()));
-
-		iterator it = begin() + std::distance(cbegin(), pos);
-		std::ranges::move_backward(it, end() - 1, end());
+		const iterator it = begin() + std::distance(cbegin(), pos);
 
-		try
-		{
-			*it = T(std::forward<Args>(args)...);
-		}
-		catch (...)
+		if constexpr (detail::may_refer_to_element_v<T, Args...>)
 		{
-			std::ranges::move(it + 1, end() + 1, it);
-			throw;
+			if (std::is_constant_evaluated() || refers_to_element(args...))
+			{
+				T value(std::forward<Args>(args)...);
+				return emplace_into_gap(it, std::move(value));
+			}
 		}
 
-		++size_;
-
-		return it;
+		return emplace_into_gap(it, std::forward<Args>(args)...);
 	}
 
 	constexpr iterator insert(const_iterator pos, size_type count, const T& value)
@@ -610,12 +685,19 @@ public:
 			return begin() + std::distance(cbegin(), pos);
 		}
 
+		const T copy(value);
 		iterator it = begin() + std::distance(cbegin(), pos);
-		detail::constexpr_uninitialized_move_n(end() - count, count, data() + size());
-		std::ranges::move(std::make_reverse_iterator(end() - count),
-			std::make_reverse_iterator(it),
-			std::make_reverse_iterator(end()));
-		std::ranges::fill_n(it, count, value);
+		open_gap(it, count);
+
+		try
+		{
+			detail::constexpr_uninitialized_fill_n(it, count, copy);
+		}
+		catch (...)
+		{
+			abandon_gap(it, count);
+			throw;
+		}
 
 		size_ += static_cast<real_size_t>(count);
 
@@ -639,12 +721,17 @@ public:
 		}
 
 		iterator it = begin() + std::distance(cbegin(), pos);
+		open_gap(it, init.size());
 
-		detail::constexpr_uninitialized_move_n(end() - init.size(), init.size(), data() + size());
-		std::ranges::move(std::make_reverse_iterator(end() - init.size()),
-			std::make_reverse_iterator(it),
-			std::make_reverse_iterator(end()));
-		std::ranges::copy_n(init.begin(), init.size(), it);
+		try
+		{
+			detail::constexpr_uninitialized_copy_n(init.begin(), init.size(), it);
+		}
+		catch (...)
+		{
+			abandon_gap(it, init.size());
+			throw;
+		}
 
 		size_ += static_cast<real_size_t>(init.size());
 
@@ -664,8 +751,22 @@ public:
 	{
 		if constexpr (not (std::ranges::sized_range<Range> || std::ranges::forward_range<Range>))
 		{
-			std::ranges::copy(std::forward<Range>(range), std::inserter(*this, pos));
-			return begin() + std::distance(cbegin(), pos);
+			const size_type offset = std::distance(cbegin(), pos);
+			const size_type old_size = size();
+
+			try
+			{
+				append_range(std::forward<Range>(range));
+			}
+			catch (...)
+			{
+				erase(begin() + old_size, end());
+				throw;
+			}
+
+			std::ranges::rotate(begin() + offset, begin() + old_size, end());
+
+			return begin() + offset;
 		}
 		else
 		{
@@ -690,18 +791,25 @@ public:
 
 			if (pos == cend()) [[unlikely]]
 			{
-				detail::constexpr_uninitialized_copy_n(std::ranges::begin(range),
-					rsize, data() + size());
+				detail::constexpr_uninitialized_transfer_n<detail::is_expiring_range_v<Range>>(
+					std::ranges::begin(range), rsize, data() + size());
 				size_ += static_cast<real_size_t>(rsize);
 				return begin() + std::distance(cbegin(), pos);
 			}
 
 			iterator it = begin() + std::distance(cbegin(), pos);
-			detail::constexpr_uninitialized_move_n(end() - rsize, rsize, data() + size());
-			std::ranges::move(std::make_reverse_iterator(end() - rsize),
-				std::make_reverse_iterator(it),
-				std::make_reverse_iterator(end()));
-			std::ranges::copy_n(std::ranges::begin(range), rsize, it);
+			open_gap(it, rsize);
+
+			try
+			{
+				detail::constexpr_uninitialized_transfer_n<detail::is_expiring_range_v<Range>>(
+					std::ranges::begin(range), rsize, it);
+			}
+			catch (...)
+			{
+				abandon_gap(it, rsize);
+				throw;
+			}
 
 			size_ += static_cast<real_size_t>(rsize);
 
@@ -774,16 +882,185 @@ public:
 					rsize, size(), capacity()) };
 			}
 
-			detail::constexpr_uninitialized_copy_n(data() + size(),
-				rsize, std::ranges::begin(range));
+			detail::constexpr_uninitialized_transfer_n<detail::is_expiring_range_v<Range>>(
+				std::ranges::begin(range), rsize, data() + size());
 			size_ += static_cast<real_size_t>(rsize);
 		}
+		else if constexpr (detail::is_expiring_range_v<Range>)
+		{
+			for (auto&& val : range)
+			{
+				emplace_back(std::move(val));
+			}
+		}
 		else
 		{
 			std::ranges::copy(std::forward<Range>(range), std::back_inserter(*this));
 		}
 	}
 
+	template<typename Generator>
+		requires (std::constructible_from<T, std::invoke_result_t<Generator&>>)
+	constexpr void emplace_back_n(size_type count, Generator generator)
+	{
+		if (size() + count > capacity()) [[unlikely]]
+		{
+			throw std::length_error{ std::format("Static vector emplace_back_n call "
+				"for {} elements with already {} elements in the vector "
+				"would exceed the vector's capacity of {}",
+				count, size(), capacity()) };
+		}
+
+		detail::constexpr_uninitialized_generate_n(data() + size(), count,
+			[&](size_type) { return std::invoke(generator); });
+		size_ += static_cast<real_size_t>(count);
+	}
+
+	template<typename Function>
+		requires (std::constructible_from<T, std::invoke_result_t<Function&, size_type>>)
+	constexpr void append_generate(size_type count, Function fn)
+	{
+		if (size() + count > capacity()) [[unlikely]]
+		{
+			throw std::length_error{ std::format("Static vector append_generate call "
+				"for {} elements with already {} elements in the vector "
+				"would exceed the vector's capacity of {}",
+				count, size(), capacity()) };
+		}
+
+		detail::constexpr_uninitialized_generate_n(data() + size(), count, std::move(fn));
+		size_ += static_cast<real_size_t>(count);
+	}
+
+	template<typename U = T, typename Compare = std::ranges::less>
+		requires (std::constructible_from<T, U&&>)
+	constexpr iterator insert_sorted(U&& value, Compare comp = {})
+	{
+		const iterator pos = std::ranges::upper_bound(begin(), end(), value, std::ref(comp));
+		return emplace(pos, std::forward<U>(value));
+	}
+
+	template<std::ranges::input_range Range, typename Compare = std::ranges::less>
+	constexpr void insert_sorted_range(Range&& range, Compare comp = {})
+	{
+		const size_type middle = size();
+		append_or_rollback(middle, std::forward<Range>(range));
+
+		std::ranges::sort(begin() + middle, end(), std::ref(comp));
+		merge_tail(middle, comp);
+	}
+
+	template<std::ranges::input_range Range, typename Compare = std::ranges::less>
+	constexpr void merge_from(Range&& sorted, Compare comp = {})
+	{
+		const size_type middle = size();
+		append_or_rollback(middle, std::forward<Range>(sorted));
+
+		merge_tail(middle, comp);
+	}
+
+	template<std::ranges::input_range Range, typename Compare = std::ranges::less>
+	constexpr void set_union(const Range& sorted, Compare comp = {})
+	{
+		const size_type middle = size();
+		auto first = std::ranges::begin(sorted);
+		const auto last = std::ranges::end(sorted);
+
+		try
+		{
+			for (size_type i = 0; first != last;)
+			{
+				if (i == middle || std::invoke(comp, *first, (*this)[i]))
+				{
+					emplace_back(*first);
+					++first;
+				}
+				else if (std::invoke(comp, (*this)[i], *first))
+				{
+					++i;
+				}
+				else
+				{
+					++i;
+					++first;
+				}
+			}
+		}
+		catch (...)
+		{
+			erase(begin() + middle, end());
+			throw;
+		}
+
+		merge_tail(middle, comp);
+	}
+
+	template<std::ranges::input_range Range, typename Compare = std::ranges::less>
+	constexpr void set_intersection(const Range& sorted, Compare comp = {})
+	{
+		iterator out = begin();
+		iterator it = begin();
+		auto first = std::ranges::begin(sorted);
+		const auto last = std::ranges::end(sorted);
+
+		while (it != end() && first != last)
+		{
+			if (std::invoke(comp, *it, *first))
+			{
+				++it;
+			}
+			else if (std::invoke(comp, *first, *it))
+			{
+				++first;
+			}
+			else
+			{
+				if (out != it)
+				{
+					*out = std::move(*it);
+				}
+				++out;
+				++it;
+				++first;
+			}
+		}
+
+		erase(out, end());
+	}
+
+	template<std::ranges::input_range Range, typename Compare = std::ranges::less>
+	constexpr void set_difference(const Range& sorted, Compare comp = {})
+	{
+		iterator out = begin();
+		iterator it = begin();
+		auto first = std::ranges::begin(sorted);
+		const auto last = std::ranges::end(sorted);
+
+		while (it != end())
+		{
+			if (first == last || std::invoke(comp, *it, *first))
+			{
+				if (out != it)
+				{
+					*out = std::move(*it);
+				}
+				++out;
+				++it;
+			}
+			else if (std::invoke(comp, *first, *it))
+			{
+				++first;
+			}
+			else
+			{
+				++it;
+				++first;
+			}
+		}
+
+		erase(out, end());
+	}
+
 	constexpr void pop_back() noexcept
 	{
 		std::destroy_at(data() + size() - 1);
@@ -805,9 +1082,14 @@ public:
 	{
 		const size_type offset = std::distance(cbegin(), first);
 		const size_type count = std::distance(first, last);
+		if (count == 0)
+		{
+			return begin() + offset;
+		}
+
 		std::ranges::move(begin() + offset + count, end(), begin() + offset);
 		
-		std::destroy_n(data() + size() - count, count);
+		detail::constexpr_destroy_n(data() + size() - count, count);
 
 		size_ -= static_cast<real_size_t>(count);
 
@@ -855,7 +1137,7 @@ public:
 	constexpr void clear()
 		noexcept(std::is_nothrow_destructible_v<T>)
 	{
-		std::destroy_n(data(), size());
+		detail::constexpr_destroy_n(data(), size());
 
 		size_ = 0;
 	}
@@ -871,7 +1153,7 @@ public:
 
 		if (count < size())
 		{
-			std::destroy_n(data() + count, size() - count);
+			detail::constexpr_destroy_n(data() + count, size() - count);
 		}
 		else if (count > size())
 		{
@@ -893,7 +1175,7 @@ public:
 
 		if (count < size())
 		{
-			std::destroy_n(data() + count, size() - count);
+			detail::constexpr_destroy_n(data() + count, size() - count);
 		}
 		else if (count > size())
 		{
@@ -921,7 +1203,7 @@ public:
 		}
 
 		const size_type min = std::min(count, size());
-		std::destroy_n(data() + min, size() - min);
+		detail::constexpr_destroy_n(data() + min, size() - min);
 
 		const size_type new_size = std::invoke(std::move(op), data(), min);
 		size_ = static_cast<real_size_t>(new_size);
@@ -931,7 +1213,7 @@ public:
 	noexcept(std::is_nothrow_destructible_v<T>)
 	requires(not std::is_trivially_destructible_v<T>)
 	{
-		std::destroy_n(data(), size());
+		detail::constexpr_destroy_n(data(), size());
 	}
 
 	constexpr ~static_vector() noexcept
@@ -945,7 +1227,7 @@ public:
 
 	constexpr reverse_iterator rbegin() noexcept
 	{
-		return std::make_reverse_iterator(begin());
+		return std::make_reverse_iterator(end());
 	}
 
 	constexpr iterator end() noexcept
@@ -955,7 +1237,7 @@ public:
 
 	constexpr reverse_iterator rend() noexcept
 	{
-		return std::make_reverse_iterator(end());
+		return std::make_reverse_iterator(begin());
 	}
 
 	constexpr const_iterator begin() const noexcept
@@ -970,12 +1252,12 @@ public:
 
 	constexpr const_reverse_iterator rbegin() const noexcept
 	{
-		return std::make_reverse_iterator(cbegin());
+		return std::make_reverse_iterator(cend());
 	}
 
 	constexpr const_reverse_iterator rend() const noexcept
 	{
-		return std::make_reverse_iterator(cend());
+		return std::make_reverse_iterator(cbegin());
 	}
 
 	constexpr const_iterator cbegin() const noexcept
@@ -990,28 +1272,254 @@ public:
 
 	constexpr const_reverse_iterator crbegin() const noexcept
 	{
-		return std::make_reverse_iterator(cbegin());
+		return std::make_reverse_iterator(cend());
 	}
 
 	constexpr const_reverse_iterator crend() const noexcept
 	{
-		return std::make_reverse_iterator(cend());
+		return std::make_reverse_iterator(cbegin());
 	}
 
 private:
+	template<std::ranges::input_range Range>
+	constexpr void append_or_rollback(size_type middle, Range&& range)
+	{
+		try
+		{
+			append_range(std::forward<Range>(range));
+		}
+		catch (...)
+		{
+			erase(begin() + middle, end());
+			throw;
+		}
+	}
+
+	template<typename Compare>
+	constexpr void merge_tail(size_type middle, Compare& comp)
+	{
+		const size_type tail = size() - middle;
+		if (middle == 0 || tail == 0 || not std::invoke(comp, (*this)[middle], (*this)[middle - 1]))
+		{
+			return;
+		}
+
+		if constexpr (std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
+		{
+			if (size() + tail <= capacity())
+			{
+				const iterator buffer = end();
+				detail::constexpr_uninitialized_move_n(begin() + middle, tail, buffer);
+
+				iterator left = begin() + middle;
+				iterator right = buffer + tail;
+				iterator out = end();
+
+				try
+				{
+					while (right != buffer)
+					{
+						if (left != begin() && std::invoke(comp, *(right - 1), *(left - 1)))
+						{
+							*--out = std::move(*--left);
+						}
+						else
+						{
+							*--out = std::move(*--right);
+						}
+					}
+				}
+				catch (...)
+				{
+					detail::constexpr_destroy_n(buffer, tail);
+					throw;
+				}
+
+				detail::constexpr_destroy_n(buffer, tail);
+				return;
+			}
+		}
+
+		detail::merge_without_buffer(begin(), begin() + middle, end(), comp);
+	}
+
+	constexpr void open_gap(iterator pos, size_type count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		const size_type tail = static_cast<size_type>(end() - pos);
+
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			if (not std::is_constant_evaluated())
+			{
+				std::memmove(pos + count, pos, tail * sizeof(T));
+				return;
+			}
+		}
+
+		if (count >= tail)
+		{
+			detail::constexpr_uninitialized_move_n(pos, tail, pos + count);
+		}
+		else
+		{
+			detail::constexpr_uninitialized_move_n(end() - count, count, end());
+			try
+			{
+				std::ranges::move_backward(pos, end() - count, end());
+			}
+			catch (...)
+			{
+				detail::constexpr_destroy_n(end(), count);
+				throw;
+			}
+		}
+
+		detail::constexpr_destroy_n(pos, std::min(count, tail));
+	}
+
+	template<typename ... Args>
+	constexpr iterator emplace_into_gap(iterator it, Args&& ... args)
+	{
+		open_gap(it, 1);
+
+		try
+		{
+			std::construct_at(it, std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			abandon_gap(it, 1);
+			throw;
+		}
+
+		++size_;
+
+		return it;
+	}
+
+	template<typename ... Args>
+	bool refers_to_element(const Args& ... args) const noexcept
+	{
+		const auto is_element = [this]<typename U>(const U& arg)
+		{
+			if constexpr (std::is_convertible_v<const U*, const T*>)
+			{
+				const T* const address = std::addressof(arg);
+				return not std::less<const T*>{}(address, data()) && std::less<const T*>{}(address, data() + size());
+			}
+			else
+			{
+				return false;
+			}
+		};
+
+		return (is_element(args) || ...);
+	}
+
+	// Types whose moves can throw only get the basic guarantee here: moving the tail back could
+	// throw again, so it is destroyed and the vector is truncated at pos instead.
+	constexpr void abandon_gap(iterator pos, size_type count) noexcept
+	{
+		if constexpr (std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>)
+		{
+			close_gap(pos, count);
+		}
+		else
+		{
+			detail::constexpr_destroy_n(pos + count, static_cast<size_type>(end() - pos));
+			size_ = static_cast<real_size_t>(pos - begin());
+		}
+	}
+
+	constexpr void close_gap(iterator pos, size_type count)
+	{
+		if (count == 0)
+		{
+			return;
+		}
+
+		const size_type tail = static_cast<size_type>(end() - pos);
+
+		if constexpr (std::is_trivially_copyable_v<T>)
+		{
+			if (not std::is_constant_evaluated())
+			{
+				std::memmove(pos, pos + count, tail * sizeof(T));
+				return;
+			}
+		}
+
+		if (count >= tail)
+		{
+			detail::constexpr_uninitialized_move_n(pos + count, tail, pos);
+			detail::constexpr_destroy_n(pos + count, tail);
+		}
+		else
+		{
+			detail::constexpr_uninitialized_move_n(pos + count, count, pos);
+			std::ranges::move(pos + 2 * count, end() + count, pos + count);
+			detail::constexpr_destroy_n(end(), count);
+		}
+	}
+
 	union {
 		std::byte dummy_{};
-		T data_[Capacity];
+		T data_[Capacity == 0 ? 1 : Capacity];
 	};
 	real_size_t size_ = 0;
 };
 
 template<typename T, std::size_t Size1, std::size_t Size2>
-constexpr auto operator<=>(const static_vector<T, Size1>& lhs,
+constexpr bool operator==(const static_vector<T, Size1>& lhs,
 	const static_vector<T, Size2>& rhs)
-	noexcept(noexcept(std::declval<T>() <=> std::declval<T>()))
+	noexcept(noexcept(std::declval<const T&>() == std::declval<const T&>()))
+	requires std::equality_comparable<T>
 {
-	return std::ranges::lexicographical_compare(lhs, rhs);
+	if (lhs.size() != rhs.size())
+	{
+		return false;
+	}
+
+	if constexpr (detail::is_bitwise_comparable_v<T>)
+	{
+		if (not std::is_constant_evaluated())
+		{
+			return std::memcmp(lhs.data(), rhs.data(), lhs.size() * sizeof(T)) == 0;
+		}
+	}
+
+	return std::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<typename T, std::size_t Size1, std::size_t Size2>
+constexpr std::compare_three_way_result_t<T> operator<=>(const static_vector<T, Size1>& lhs,
+	const static_vector<T, Size2>& rhs)
+	noexcept(noexcept(std::declval<const T&>() <=> std::declval<const T&>()))
+	requires std::three_way_comparable<T>
+{
+	if constexpr (detail::is_memcmp_orderable_v<T>)
+	{
+		if (not std::is_constant_evaluated())
+		{
+			const int result = std::memcmp(lhs.data(), rhs.data(),
+				std::min(lhs.size(), rhs.size()));
+
+			if (result != 0)
+			{
+				return result <=> 0;
+			}
+
+			return lhs.size() <=> rhs.size();
+		}
+	}
+
+	return std::lexicographical_compare_three_way(lhs.begin(), lhs.end(),
+		rhs.begin(), rhs.end());
 }
 
 template<typename T, std::size_t Capacity, typename U>
@@ -1031,3 +1539,122 @@ constexpr std::size_t erase(static_vector<T, Capacity>& vec, Pred pred)
 	vec.erase(it, vec.end());
 	return r;
 }
+
+template<std::size_t Capacity, std::ranges::input_range Range>
+constexpr static_vector<std::ranges::range_value_t<Range>, Capacity> to_static_vector(Range&& range)
+{
+	return static_vector<std::ranges::range_value_t<Range>, Capacity>(std::from_range,
+		std::forward<Range>(range));
+}
+
+// An empty generated range yields static_vector<T, 0>, or std::array<T, 0> from shrink_to_exact_array.
+template<auto Generator>
+	requires std::ranges::sized_range<decltype(Generator())>
+consteval auto shrink_to_exact()
+{
+	constexpr std::size_t size = static_cast<std::size_t>(std::ranges::size(Generator()));
+	return to_static_vector<size>(Generator());
+}
+
+template<auto Generator>
+	requires std::ranges::sized_range<decltype(Generator())>
+consteval auto shrink_to_exact_array()
+{
+	using value_type = std::ranges::range_value_t<decltype(Generator())>;
+
+	constexpr std::size_t size = static_cast<std::size_t>(std::ranges::size(Generator()));
+	const auto exact = to_static_vector<size>(Generator());
+
+	return [&]<std::size_t ... I>(std::index_sequence<I...>)
+	{
+		return std::array<value_type, size>{ exact[I]... };
+	}(std::make_index_sequence<size>{});
+}
+
+template<typename T, std::size_t Capacity>
+	requires std::default_initializable<std::hash<T>>
+struct std::hash<static_vector<T, Capacity>>
+{
+	std::size_t operator()(const static_vector<T, Capacity>& vec) const noexcept
+	{
+		if constexpr (detail::is_bitwise_comparable_v<T>)
+		{
+			return std::hash<std::string_view>{}(std::string_view{
+				reinterpret_cast<const char*>(vec.data()), vec.size() * sizeof(T) });
+		}
+		else
+		{
+			std::size_t seed = vec.size();
+			for (const T& value : vec)
+			{
+				seed ^= std::hash<T>{}(value) + 0x9e3779b97f4a7c15uLL + (seed << 6) + (seed >> 2);
+			}
+			return seed;
+		}
+	}
+};
+
+template<typename T, std::size_t Capacity>
+	requires (std::is_arithmetic_v<T> && not std::is_same_v<T, bool>)
+std::to_chars_result to_chars(char* first, char* last, const static_vector<T, Capacity>& values,
+	char delimiter = ',')
+{
+	for (std::size_t i = 0; i != values.size(); ++i)
+	{
+		if (i != 0)
+		{
+			if (first == last)
+			{
+				return { last, std::errc::value_too_large };
+			}
+			*first++ = delimiter;
+		}
+
+		const std::to_chars_result result = std::to_chars(first, last, values[i]);
+		if (result.ec != std::errc{})
+		{
+			return result;
+		}
+		first = result.ptr;
+	}
+
+	return { first, std::errc{} };
+}
+
+// On error, values keeps the elements parsed before the failure and ptr points at the field that
+// could not be parsed or stored, so a caller can report it or resume from there.
+template<typename T, std::size_t Capacity>
+	requires (std::is_arithmetic_v<T> && not std::is_same_v<T, bool>)
+std::from_chars_result from_chars(const char* first, const char* last, static_vector<T, Capacity>& values,
+	char delimiter = ',')
+{
+	values.clear();
+	if (first == last)
+	{
+		return { first, std::errc{} };
+	}
+
+	while (true)
+	{
+		if (values.size() == values.capacity())
+		{
+			return { first, std::errc::value_too_large };
+		}
+
+		T value{};
+		const std::from_chars_result result = std::from_chars(first, last, value);
+		if (result.ec != std::errc{})
+		{
+			return result;
+		}
+
+		values.push_back(value);
+		first = result.ptr;
+
+		if (first == last || *first != delimiter)
+		{
+			return { first, std::errc{} };
+		}
+		++first;
+	}
+}
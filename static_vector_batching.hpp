@@ -0,0 +1,492 @@
+#pragma once
+
+#include <array>
+#include <condition_variable>
+#include <coroutine>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <ranges>
+#include <type_traits>
+#include <utility>
+
+#include "static_vector.hpp"
+
+template<std::ranges::input_range View, std::size_t BatchSize>
+	requires std::ranges::view<View>
+class static_chunk_view : public std::ranges::view_interface<static_chunk_view<View, BatchSize>>
+{
+	static_assert(BatchSize > 0, "Batches must hold at least one element");
+
+public:
+	using batch_type = static_vector<std::ranges::range_value_t<View>, BatchSize>;
+
+	class iterator
+	{
+	public:
+		using iterator_concept = std::input_iterator_tag;
+		using value_type = batch_type;
+		using difference_type = std::ptrdiff_t;
+
+		constexpr iterator() = default;
+
+		constexpr batch_type& operator*() const noexcept
+		{
+			return parent_->batch_;
+		}
+
+		constexpr iterator& operator++()
+		{
+			parent_->fill();
+			return *this;
+		}
+
+		constexpr void operator++(int)
+		{
+			++*this;
+		}
+
+		friend constexpr bool operator==(const iterator& it, std::default_sentinel_t) noexcept
+		{
+			return it.exhausted();
+		}
+
+	private:
+		friend class static_chunk_view;
+
+		constexpr bool exhausted() const noexcept
+		{
+			return parent_->batch_.empty();
+		}
+
+		constexpr explicit iterator(static_chunk_view* parent) noexcept
+			: parent_{ parent }
+		{
+		}
+
+		static_chunk_view* parent_ = nullptr;
+	};
+
+	constexpr static_chunk_view()
+		requires std::default_initializable<View>
+	= default;
+
+	constexpr explicit static_chunk_view(View base)
+		: base_{ std::move(base) }
+	{
+	}
+
+	constexpr iterator begin()
+	{
+		current_ = std::ranges::begin(base_);
+		fill();
+		return iterator{ this };
+	}
+
+	constexpr std::default_sentinel_t end() const noexcept
+	{
+		return std::default_sentinel;
+	}
+
+	constexpr View base() const&
+		requires std::copy_constructible<View>
+	{
+		return base_;
+	}
+
+	constexpr View base() &&
+	{
+		return std::move(base_);
+	}
+
+private:
+	constexpr void fill()
+	{
+		batch_.clear();
+
+		if constexpr (std::sized_sentinel_for<std::ranges::sentinel_t<View>, std::ranges::iterator_t<View>>
+			&& std::ranges::forward_range<View>)
+		{
+			const auto count = std::min<std::ranges::range_difference_t<View>>(
+				std::ranges::end(base_) - *current_, static_cast<std::ranges::range_difference_t<View>>(BatchSize));
+			const auto last = std::ranges::next(*current_, count);
+
+			batch_.append_range(std::ranges::subrange(*current_, last));
+			current_ = last;
+		}
+		else
+		{
+			for (; *current_ != std::ranges::end(base_) && batch_.size() != BatchSize; ++*current_)
+			{
+				batch_.emplace_back(**current_);
+			}
+		}
+	}
+
+	View base_;
+	std::optional<std::ranges::iterator_t<View>> current_;
+	batch_type batch_;
+};
+
+template<std::size_t BatchSize, std::ranges::viewable_range Range>
+constexpr auto chunked_into(Range&& range)
+{
+	return static_chunk_view<std::views::all_t<Range>, BatchSize>{ std::views::all(std::forward<Range>(range)) };
+}
+
+namespace views
+{
+	template<std::size_t BatchSize>
+	struct chunk_static_fn
+	{
+		template<std::ranges::viewable_range Range>
+		constexpr auto operator()(Range&& range) const
+		{
+			return chunked_into<BatchSize>(std::forward<Range>(range));
+		}
+
+		template<std::ranges::viewable_range Range>
+		friend constexpr auto operator|(Range&& range, const chunk_static_fn& fn)
+		{
+			return fn(std::forward<Range>(range));
+		}
+	};
+
+	template<std::size_t BatchSize>
+	inline constexpr chunk_static_fn<BatchSize> chunk_static{};
+}
+
+namespace detail
+{
+	struct resumable_waiter
+	{
+		std::coroutine_handle<> handle;
+		resumable_waiter* next = nullptr;
+	};
+
+	// Waiters woken while another one is being resumed on this thread are queued and resumed by the
+	// outermost call once the current one suspends, so chains of hand-offs do not nest stack frames.
+	inline void resume_waiter(resumable_waiter& waiter)
+	{
+		struct pending_waiters
+		{
+			resumable_waiter* head = nullptr;
+			resumable_waiter* tail = nullptr;
+			bool resuming = false;
+		};
+		thread_local pending_waiters pending;
+
+		(pending.tail != nullptr ? pending.tail->next : pending.head) = &waiter;
+		pending.tail = &waiter;
+		if (pending.resuming)
+		{
+			return;
+		}
+
+		pending.resuming = true;
+		try
+		{
+			while (resumable_waiter* const next = pending.head)
+			{
+				pending.head = std::exchange(next->next, nullptr);
+				if (pending.head == nullptr)
+				{
+					pending.tail = nullptr;
+				}
+				next->handle.resume();
+			}
+		}
+		catch (...)
+		{
+			pending.resuming = false;
+			throw;
+		}
+		pending.resuming = false;
+	}
+}
+
+template<typename T, std::size_t BatchSize, std::size_t Depth = 4>
+class batch_channel
+{
+public:
+	using batch_type = static_vector<T, BatchSize>;
+
+	class push_awaiter
+	{
+	public:
+		bool await_ready() const noexcept
+		{
+			return false;
+		}
+
+		bool await_suspend(std::coroutine_handle<> handle)
+		{
+			waiter_.handle = handle;
+			return channel_->suspend_push(*this);
+		}
+
+		bool await_resume() const noexcept
+		{
+			return accepted_;
+		}
+
+	private:
+		friend class batch_channel;
+
+		push_awaiter(batch_channel* channel, batch_type&& batch)
+			: channel_{ channel }, batch_{ std::move(batch) }
+		{
+		}
+
+		batch_channel* channel_;
+		batch_type batch_;
+		detail::resumable_waiter waiter_;
+		push_awaiter* next_ = nullptr;
+		bool accepted_ = false;
+	};
+
+	class pop_awaiter
+	{
+	public:
+		bool await_ready() const noexcept
+		{
+			return false;
+		}
+
+		bool await_suspend(std::coroutine_handle<> handle)
+		{
+			waiter_.handle = handle;
+			return channel_->suspend_pop(*this);
+		}
+
+		std::optional<batch_type> await_resume() noexcept(std::is_nothrow_move_constructible_v<batch_type>)
+		{
+			return std::move(batch_);
+		}
+
+	private:
+		friend class batch_channel;
+
+		explicit pop_awaiter(batch_channel* channel) noexcept
+			: channel_{ channel }
+		{
+		}
+
+		batch_channel* channel_;
+		std::optional<batch_type> batch_;
+		detail::resumable_waiter waiter_;
+		pop_awaiter* next_ = nullptr;
+	};
+
+	batch_channel() = default;
+	batch_channel(const batch_channel&) = delete;
+	batch_channel& operator=(const batch_channel&) = delete;
+
+	bool push(batch_type batch)
+	{
+		std::unique_lock lock{ mutex_ };
+		not_full_.wait(lock, [&] { return closed_ || count_ != Depth; });
+		if (closed_)
+		{
+			return false;
+		}
+
+		deliver(std::move(batch), lock);
+		return true;
+	}
+
+	bool try_push(batch_type& batch)
+	{
+		std::unique_lock lock{ mutex_ };
+		if (closed_ || count_ == Depth)
+		{
+			return false;
+		}
+
+		deliver(std::move(batch), lock);
+		return true;
+	}
+
+	std::optional<batch_type> pop()
+	{
+		std::unique_lock lock{ mutex_ };
+		not_empty_.wait(lock, [&] { return closed_ || count_ != 0; });
+		if (count_ == 0)
+		{
+			return std::nullopt;
+		}
+
+		return take(lock);
+	}
+
+	std::optional<batch_type> try_pop()
+	{
+		std::unique_lock lock{ mutex_ };
+		if (count_ == 0)
+		{
+			return std::nullopt;
+		}
+
+		return take(lock);
+	}
+
+	[[nodiscard]] push_awaiter async_push(batch_type batch)
+	{
+		return push_awaiter{ this, std::move(batch) };
+	}
+
+	[[nodiscard]] pop_awaiter async_pop() noexcept
+	{
+		return pop_awaiter{ this };
+	}
+
+	void close()
+	{
+		pop_awaiter* poppers;
+		push_awaiter* pushers;
+		{
+			const std::lock_guard lock{ mutex_ };
+			closed_ = true;
+			poppers = std::exchange(pop_waiters_.head, nullptr);
+			pushers = std::exchange(push_waiters_.head, nullptr);
+			pop_waiters_.tail = nullptr;
+			push_waiters_.tail = nullptr;
+		}
+		not_full_.notify_all();
+		not_empty_.notify_all();
+
+		while (poppers != nullptr)
+		{
+			detail::resume_waiter(std::exchange(poppers, poppers->next_)->waiter_);
+		}
+		while (pushers != nullptr)
+		{
+			detail::resume_waiter(std::exchange(pushers, pushers->next_)->waiter_);
+		}
+	}
+
+	bool closed() const
+	{
+		const std::lock_guard lock{ mutex_ };
+		return closed_;
+	}
+
+private:
+	template<typename Awaiter>
+	struct waiter_queue
+	{
+		void push(Awaiter* awaiter) noexcept
+		{
+			(tail != nullptr ? tail->next_ : head) = awaiter;
+			tail = awaiter;
+		}
+
+		Awaiter* pop() noexcept
+		{
+			Awaiter* const awaiter = head;
+			if (awaiter != nullptr)
+			{
+				head = std::exchange(awaiter->next_, nullptr);
+				if (head == nullptr)
+				{
+					tail = nullptr;
+				}
+			}
+			return awaiter;
+		}
+
+		Awaiter* head = nullptr;
+		Awaiter* tail = nullptr;
+	};
+
+	bool suspend_push(push_awaiter& awaiter)
+	{
+		std::unique_lock lock{ mutex_ };
+		if (closed_ || count_ == Depth)
+		{
+			if (not closed_)
+			{
+				push_waiters_.push(&awaiter);
+			}
+			return not closed_;
+		}
+
+		awaiter.accepted_ = true;
+		deliver(std::move(awaiter.batch_), lock);
+		return false;
+	}
+
+	bool suspend_pop(pop_awaiter& awaiter)
+	{
+		std::unique_lock lock{ mutex_ };
+		if (count_ == 0)
+		{
+			if (not closed_)
+			{
+				pop_waiters_.push(&awaiter);
+			}
+			return not closed_;
+		}
+
+		awaiter.batch_ = take(lock);
+		return false;
+	}
+
+	void deliver(batch_type&& batch, std::unique_lock<std::mutex>& lock)
+	{
+		if (pop_awaiter* const popper = pop_waiters_.pop())
+		{
+			popper->batch_ = std::move(batch);
+			lock.unlock();
+			detail::resume_waiter(popper->waiter_);
+			return;
+		}
+
+		enqueue(std::move(batch));
+		lock.unlock();
+		not_empty_.notify_one();
+	}
+
+	batch_type take(std::unique_lock<std::mutex>& lock)
+	{
+		batch_type batch = dequeue();
+
+		if (push_awaiter* const pusher = push_waiters_.pop())
+		{
+			enqueue(std::move(pusher->batch_));
+			pusher->accepted_ = true;
+			lock.unlock();
+			detail::resume_waiter(pusher->waiter_);
+			return batch;
+		}
+
+		lock.unlock();
+		not_full_.notify_one();
+		return batch;
+	}
+
+	void enqueue(batch_type&& batch)
+	{
+		ring_[(head_ + count_) % Depth] = std::move(batch);
+		++count_;
+	}
+
+	batch_type dequeue()
+	{
+		batch_type batch = std::move(ring_[head_]);
+		ring_[head_].clear();
+		head_ = (head_ + 1) % Depth;
+		--count_;
+		return batch;
+	}
+
+	std::array<batch_type, Depth> ring_{};
+	std::size_t head_ = 0;
+	std::size_t count_ = 0;
+	bool closed_ = false;
+	waiter_queue<pop_awaiter> pop_waiters_;
+	waiter_queue<push_awaiter> push_waiters_;
+	mutable std::mutex mutex_;
+	std::condition_variable not_full_;
+	std::condition_variable not_empty_;
+};
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cerrno>
+#include <cstddef>
+#include <span>
+#include <system_error>
+
+#include "static_vector.hpp"
+
+#if __has_include(<sys/uio.h>)
+
+#include <sys/uio.h>
+
+template<std::size_t Capacity>
+iovec filled_iovec(const static_vector<std::byte, Capacity>& buffer) noexcept
+{
+	return iovec{ const_cast<std::byte*>(buffer.data()), buffer.size() };
+}
+
+template<std::size_t Capacity>
+iovec spare_iovec(static_vector<std::byte, Capacity>& buffer) noexcept
+{
+	return iovec{ buffer.data() + buffer.size(), buffer.capacity() - buffer.size() };
+}
+
+template<std::size_t Count>
+static_vector<iovec, Count> gather_iovecs(const static_vector<std::span<const std::byte>, Count>& spans) noexcept
+{
+	static_vector<iovec, Count> iovecs;
+	for (const std::span<const std::byte> span : spans)
+	{
+		iovecs.push_back(iovec{ const_cast<std::byte*>(span.data()), span.size() });
+	}
+	return iovecs;
+}
+
+namespace detail
+{
+	template<typename Operation>
+	std::size_t retry_on_interrupt(Operation op, const char* what)
+	{
+		while (true)
+		{
+			const ssize_t result = op();
+			if (result >= 0)
+			{
+				return static_cast<std::size_t>(result);
+			}
+			if (errno != EINTR)
+			{
+				throw std::system_error{ errno, std::generic_category(), what };
+			}
+		}
+	}
+}
+
+template<std::size_t Capacity>
+std::size_t read_append(int fd, static_vector<std::byte, Capacity>& buffer,
+	std::size_t max = static_cast<std::size_t>(-1))
+{
+	iovec spare = spare_iovec(buffer);
+	spare.iov_len = std::min(spare.iov_len, max);
+
+	const std::size_t read = detail::retry_on_interrupt([&] { return ::readv(fd, &spare, 1); }, "readv");
+
+	const std::size_t new_size = buffer.size() + read;
+	buffer.resize_and_overwrite(new_size, [=](std::byte*, std::size_t) { return new_size; });
+
+	return read;
+}
+
+template<std::size_t Capacity>
+std::size_t write_some(int fd, const static_vector<std::byte, Capacity>& buffer)
+{
+	const iovec filled = filled_iovec(buffer);
+
+	return detail::retry_on_interrupt([&] { return ::writev(fd, &filled, 1); }, "writev");
+}
+
+template<std::size_t Count>
+std::size_t write_gather(int fd, const static_vector<std::span<const std::byte>, Count>& spans)
+{
+	const static_vector<iovec, Count> iovecs = gather_iovecs(spans);
+
+	return detail::retry_on_interrupt([&]
+		{
+			return ::writev(fd, iovecs.data(), static_cast<int>(iovecs.size()));
+		}, "writev");
+}
+
+#endif
@@ -0,0 +1,247 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <exception>
+#include <execution>
+#include <functional>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <thread>
+#include <type_traits>
+
+#include "static_vector.hpp"
+
+namespace parallel
+{
+	struct jthread_policy
+	{
+		static constexpr std::size_t max_threads = 64;
+
+		std::size_t thread_count = std::clamp<std::size_t>(std::thread::hardware_concurrency(), 1, max_threads);
+		std::size_t chunk_bytes = 256 * 1024;
+	};
+
+	inline const jthread_policy par_jthread{};
+
+	template<typename Policy>
+	concept std_execution_policy = std::is_execution_policy_v<std::remove_cvref_t<Policy>>;
+}
+
+namespace detail
+{
+	template<typename T>
+	constexpr std::size_t chunk_elements(const parallel::jthread_policy& policy) noexcept
+	{
+		return std::max<std::size_t>(1, policy.chunk_bytes / sizeof(T));
+	}
+
+	template<typename Function>
+	void run_chunks(const parallel::jthread_policy& policy, std::size_t count,
+		std::size_t chunk_size, Function fn)
+	{
+		const std::size_t chunks = (count + chunk_size - 1) / chunk_size;
+		const std::size_t workers = std::clamp<std::size_t>(std::min(policy.thread_count, chunks),
+			1, parallel::jthread_policy::max_threads);
+
+		std::atomic<std::size_t> next_chunk{ 0 };
+		std::exception_ptr error;
+		std::mutex error_mutex;
+
+		auto worker = [&](std::size_t worker_index)
+		{
+			try
+			{
+				for (std::size_t chunk = next_chunk.fetch_add(1, std::memory_order_relaxed); chunk < chunks;
+					chunk = next_chunk.fetch_add(1, std::memory_order_relaxed))
+				{
+					const std::size_t first = chunk * chunk_size;
+					std::invoke(fn, worker_index, first, std::min(first + chunk_size, count));
+				}
+			}
+			catch (...)
+			{
+				next_chunk.store(chunks, std::memory_order_relaxed);
+				const std::lock_guard lock{ error_mutex };
+				if (not error)
+				{
+					error = std::current_exception();
+				}
+			}
+		};
+
+		{
+			static_vector<std::jthread, parallel::jthread_policy::max_threads> threads;
+			for (std::size_t i = 1; i < workers; ++i)
+			{
+				threads.emplace_back(worker, i);
+			}
+			worker(0);
+		}
+
+		if (error)
+		{
+			std::rethrow_exception(error);
+		}
+	}
+}
+
+namespace parallel
+{
+	template<std_execution_policy Policy, typename T, std::size_t Capacity, typename UnaryOperation>
+	void transform(Policy&& policy, static_vector<T, Capacity>& vec, UnaryOperation op)
+	{
+		std::transform(std::forward<Policy>(policy), vec.begin(), vec.end(), vec.begin(), std::move(op));
+	}
+
+	template<typename T, std::size_t Capacity, typename UnaryOperation>
+	void transform(const jthread_policy& policy, static_vector<T, Capacity>& vec, UnaryOperation op)
+	{
+		detail::run_chunks(policy, vec.size(), detail::chunk_elements<T>(policy),
+			[&](std::size_t, std::size_t first, std::size_t last)
+			{
+				std::transform(vec.begin() + first, vec.begin() + last, vec.begin() + first, op);
+			});
+	}
+
+	template<std_execution_policy Policy, typename T, std::size_t Capacity,
+		typename U = T, typename BinaryOperation = std::plus<>>
+	U reduce(Policy&& policy, const static_vector<T, Capacity>& vec, U init = U{}, BinaryOperation op = {})
+	{
+		return std::reduce(std::forward<Policy>(policy), vec.begin(), vec.end(), std::move(init), std::move(op));
+	}
+
+	template<typename T, std::size_t Capacity, typename U = T, typename BinaryOperation = std::plus<>>
+	U reduce(const jthread_policy& policy, const static_vector<T, Capacity>& vec,
+		U init = U{}, BinaryOperation op = {})
+	{
+		std::array<std::optional<U>, jthread_policy::max_threads> partials;
+
+		detail::run_chunks(policy, vec.size(), detail::chunk_elements<T>(policy),
+			[&](std::size_t worker, std::size_t first, std::size_t last)
+			{
+				U chunk = std::reduce(vec.begin() + first + 1, vec.begin() + last,
+					static_cast<U>(vec[first]), op);
+
+				partials[worker] = partials[worker]
+					? std::invoke(op, std::move(*partials[worker]), std::move(chunk)) : std::move(chunk);
+			});
+
+		for (std::optional<U>& partial : partials)
+		{
+			if (partial)
+			{
+				init = std::invoke(op, std::move(init), std::move(*partial));
+			}
+		}
+
+		return init;
+	}
+
+	template<std_execution_policy Policy, typename T, std::size_t Capacity, typename Compare = std::less<>>
+	void sort(Policy&& policy, static_vector<T, Capacity>& vec, Compare comp = {})
+	{
+		std::sort(std::forward<Policy>(policy), vec.begin(), vec.end(), std::move(comp));
+	}
+
+	template<typename T, std::size_t Capacity, typename Compare = std::less<>>
+	void sort(const jthread_policy& policy, static_vector<T, Capacity>& vec, Compare comp = {})
+	{
+		const std::size_t chunk_size = std::max(detail::chunk_elements<T>(policy),
+			(vec.size() + policy.thread_count - 1) / std::max<std::size_t>(policy.thread_count, 1));
+
+		detail::run_chunks(policy, vec.size(), chunk_size,
+			[&](std::size_t, std::size_t first, std::size_t last)
+			{
+				std::sort(vec.begin() + first, vec.begin() + last, comp);
+			});
+
+		for (std::size_t run = chunk_size; run < vec.size(); run *= 2)
+		{
+			detail::run_chunks(policy, vec.size(), 2 * run,
+				[&](std::size_t, std::size_t first, std::size_t last)
+				{
+					if (first + run < last)
+					{
+						std::inplace_merge(vec.begin() + first, vec.begin() + first + run,
+							vec.begin() + last, comp);
+					}
+				});
+		}
+	}
+
+	template<std_execution_policy Policy, typename T, std::size_t Capacity, typename Pred>
+	std::size_t erase_if(Policy&& policy, static_vector<T, Capacity>& vec, Pred pred)
+	{
+		const auto it = std::remove_if(std::forward<Policy>(policy), vec.begin(), vec.end(), std::move(pred));
+		const std::size_t removed = static_cast<std::size_t>(std::distance(it, vec.end()));
+		vec.erase(it, vec.end());
+		return removed;
+	}
+
+	template<typename T, std::size_t Capacity, typename Pred>
+	std::size_t erase_if(const jthread_policy& policy, static_vector<T, Capacity>& vec, Pred pred)
+	{
+		constexpr std::size_t max_chunks = 1024;
+
+		const std::size_t chunk_size = std::max(detail::chunk_elements<T>(policy),
+			(vec.size() + max_chunks - 1) / max_chunks);
+		const std::size_t chunks = (vec.size() + chunk_size - 1) / chunk_size;
+
+		std::array<std::size_t, max_chunks> kept{};
+
+		detail::run_chunks(policy, vec.size(), chunk_size,
+			[&](std::size_t, std::size_t first, std::size_t last)
+			{
+				const auto it = std::remove_if(vec.begin() + first, vec.begin() + last, pred);
+				kept[first / chunk_size] = static_cast<std::size_t>(it - (vec.begin() + first));
+			});
+
+		auto out = vec.begin() + (chunks != 0 ? kept[0] : 0);
+		for (std::size_t chunk = 1; chunk < chunks; ++chunk)
+		{
+			const auto first = vec.begin() + chunk * chunk_size;
+			out = out == first ? first + kept[chunk] : std::move(first, first + kept[chunk], out);
+		}
+
+		const std::size_t removed = static_cast<std::size_t>(vec.end() - out);
+		vec.erase(out, vec.end());
+		return removed;
+	}
+
+	template<std_execution_policy Policy, typename T, std::size_t Capacity, typename U>
+	auto find(Policy&& policy, static_vector<T, Capacity>& vec, const U& value)
+	{
+		return std::find(std::forward<Policy>(policy), vec.begin(), vec.end(), value);
+	}
+
+	template<typename T, std::size_t Capacity, typename U>
+	auto find(const jthread_policy& policy, static_vector<T, Capacity>& vec, const U& value)
+	{
+		std::atomic<std::size_t> found{ vec.size() };
+
+		detail::run_chunks(policy, vec.size(), detail::chunk_elements<T>(policy),
+			[&](std::size_t, std::size_t first, std::size_t last)
+			{
+				if (first >= found.load(std::memory_order_relaxed))
+				{
+					return;
+				}
+
+				const auto it = std::find(vec.begin() + first, vec.begin() + last, value);
+				if (it != vec.begin() + last)
+				{
+					std::size_t index = static_cast<std::size_t>(it - vec.begin());
+					std::size_t current = found.load(std::memory_order_relaxed);
+					while (index < current && not found.compare_exchange_weak(current, index,
+						std::memory_order_relaxed))
+					{
+					}
+				}
+			});
+
+		return vec.begin() + found.load();
+	}
+}
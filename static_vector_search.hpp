@@ -0,0 +1,184 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+#include "static_vector.hpp"
+
+namespace detail
+{
+	template<typename T>
+	inline constexpr std::size_t linear_search_threshold_v =
+		std::is_arithmetic_v<T> ? std::max<std::size_t>(8, 256 / sizeof(T)) : 8;
+
+	template<typename T, typename U, typename Compare>
+	constexpr std::size_t linear_lower_bound_index(const T* first, std::size_t count,
+		const U& value, Compare& comp)
+	{
+		std::size_t less = 0;
+		for (std::size_t i = 0; i != count; ++i)
+		{
+			less += static_cast<std::size_t>(static_cast<bool>(std::invoke(comp, first[i], value)));
+		}
+		return less;
+	}
+
+	template<std::size_t Capacity, typename T, typename U, typename Compare>
+	constexpr std::size_t branchless_lower_bound_index(const T* first, std::size_t count,
+		const U& value, Compare& comp)
+	{
+		if (count == 0)
+		{
+			return 0;
+		}
+
+		const T* base = first;
+		std::size_t length = count;
+		for (std::size_t step = 0; step != std::bit_width(Capacity); ++step)
+		{
+			const std::size_t half = length / 2;
+			base = std::invoke(comp, base[half], value) ? base + half : base;
+			length -= half;
+		}
+
+		return static_cast<std::size_t>(base - first)
+			+ static_cast<std::size_t>(static_cast<bool>(std::invoke(comp, *base, value)));
+	}
+
+	inline void prefetch(const void* address) noexcept
+	{
+#if defined(__GNUC__) || defined(__clang__)
+		__builtin_prefetch(address);
+#else
+		static_cast<void>(address);
+#endif
+	}
+}
+
+template<typename T, std::size_t Capacity, typename U, typename Compare = std::ranges::less>
+constexpr auto branchless_lower_bound(static_vector<T, Capacity>& vec, const U& value, Compare comp = {})
+{
+	return vec.begin() + detail::branchless_lower_bound_index<Capacity>(vec.data(), vec.size(), value, comp);
+}
+
+template<typename T, std::size_t Capacity, typename U, typename Compare = std::ranges::less>
+constexpr auto branchless_lower_bound(const static_vector<T, Capacity>& vec, const U& value, Compare comp = {})
+{
+	return vec.begin() + detail::branchless_lower_bound_index<Capacity>(vec.data(), vec.size(), value, comp);
+}
+
+template<typename T, std::size_t Capacity, typename U, typename Compare = std::ranges::less>
+constexpr auto linear_lower_bound(static_vector<T, Capacity>& vec, const U& value, Compare comp = {})
+{
+	return vec.begin() + detail::linear_lower_bound_index(vec.data(), vec.size(), value, comp);
+}
+
+template<typename T, std::size_t Capacity, typename U, typename Compare = std::ranges::less>
+constexpr auto linear_lower_bound(const static_vector<T, Capacity>& vec, const U& value, Compare comp = {})
+{
+	return vec.begin() + detail::linear_lower_bound_index(vec.data(), vec.size(), value, comp);
+}
+
+template<typename T, std::size_t Capacity, typename U, typename Compare = std::ranges::less>
+constexpr auto fast_lower_bound(const static_vector<T, Capacity>& vec, const U& value, Compare comp = {})
+{
+	if constexpr (Capacity <= detail::linear_search_threshold_v<T>)
+	{
+		return linear_lower_bound(vec, value, std::move(comp));
+	}
+	else
+	{
+		if (vec.size() <= detail::linear_search_threshold_v<T>)
+		{
+			return linear_lower_bound(vec, value, std::move(comp));
+		}
+		return branchless_lower_bound(vec, value, std::move(comp));
+	}
+}
+
+template<typename T, std::size_t Capacity, typename U, typename Compare = std::ranges::less>
+constexpr auto fast_lower_bound(static_vector<T, Capacity>& vec, const U& value, Compare comp = {})
+{
+	return vec.begin() + (fast_lower_bound(std::as_const(vec), value, std::move(comp)) - vec.cbegin());
+}
+
+template<typename T, std::size_t Capacity, typename Compare = std::ranges::less>
+	requires std::default_initializable<T>
+class static_eytzinger_index
+{
+private:
+	using rank_t = detail::smallest_size_type_t<Capacity>;
+
+public:
+	using value_type = T;
+	using size_type = std::size_t;
+
+	constexpr static_eytzinger_index() = default;
+
+	constexpr explicit static_eytzinger_index(const static_vector<T, Capacity>& sorted, Compare comp = {})
+		: comp_{ std::move(comp) }
+	{
+		rebuild(sorted);
+	}
+
+	constexpr void rebuild(const static_vector<T, Capacity>& sorted)
+	{
+		tree_.clear();
+		ranks_.clear();
+		tree_.resize(sorted.size() + 1);
+		ranks_.resize(sorted.size() + 1);
+
+		fill(sorted, 0, 1);
+	}
+
+	template<typename U>
+	constexpr size_type lower_bound(const U& value) const
+	{
+		const size_type count = size();
+
+		size_type node = 1;
+		while (node <= count)
+		{
+			if (not std::is_constant_evaluated())
+			{
+				detail::prefetch(tree_.data() + std::min(node * prefetch_stride, count));
+			}
+			node = 2 * node + static_cast<size_type>(static_cast<bool>(std::invoke(comp_, tree_[node], value)));
+		}
+		node >>= std::countr_one(node) + 1;
+
+		return node == 0 ? count : static_cast<size_type>(ranks_[node]);
+	}
+
+	constexpr size_type size() const noexcept
+	{
+		return tree_.size() - 1;
+	}
+
+	constexpr bool empty() const noexcept
+	{
+		return size() == 0;
+	}
+
+private:
+	static constexpr size_type prefetch_stride = std::max<size_type>(1, 64 / sizeof(T));
+
+	constexpr size_type fill(const static_vector<T, Capacity>& sorted, size_type next, size_type node)
+	{
+		if (node <= size())
+		{
+			next = fill(sorted, next, 2 * node);
+			tree_[node] = sorted[next];
+			ranks_[node] = static_cast<rank_t>(next);
+			next = fill(sorted, next + 1, 2 * node + 1);
+		}
+		return next;
+	}
+
+	static_vector<T, Capacity + 1> tree_{ T{} };
+	static_vector<rank_t, Capacity + 1> ranks_{ rank_t{ 0 } };
+	[[no_unique_address]] Compare comp_{};
+};